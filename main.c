@@ -29,11 +29,17 @@
 #include <stdint.h>
 #include <limits.h>
 #include <stdio.h>
+#include <string.h>
 #include "uart.h"
 #include "utils.h"
 #include "ref.h"
 #include "ucsim.h"
 
+// Can't include stdlib.h, because its div_t and ldiv_t typedefs clash with
+// those in utils.h, so declare the library functions used for comparison here.
+extern long int atol(const char *nptr);
+extern unsigned long int strtoul(const char *nptr, char **endptr, int base);
+
 #define CLK_CKDIVR (*(volatile uint8_t *)(0x50C6))
 
 // PC5 is connected to the built-in LED on the STM8S208 Nucleo-64 board.
@@ -92,12 +98,18 @@ static void test_swap(test_result_t *result) {
 	static const uint32_t vals_32[] = {
 		0xAABBCCDDUL, 0x00000000UL, 0xFFFFFFFFUL, 0x5555AAAAUL,
 	};
+	static const uint16_t lens[] = { 0, 1, 3 };
 
 	for(size_t i = 0; i < (sizeof(vals_8) / sizeof(vals_8[0])); i++) {
 		uint8_t foo = swap_ref(vals_8[i]);
 		uint8_t bar = swap(vals_8[i]);
 		printf("0x%02X: swap_ref = 0x%02X, swap = 0x%02X - %s\n", vals_8[i], foo, bar, (foo == bar ? pass_str : fail_str));
 		count_test_result(foo == bar, result);
+#if defined(__reg_args)
+		bar = swap_ra(vals_8[i]);
+		printf("0x%02X: swap_ref = 0x%02X, swap_ra = 0x%02X - %s\n", vals_8[i], foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+#endif
 	}
 
 	for(size_t i = 0; i < (sizeof(vals_16) / sizeof(vals_16[0])); i++) {
@@ -105,6 +117,11 @@ static void test_swap(test_result_t *result) {
 		uint16_t bar = bswap_16(vals_16[i]);
 		printf("0x%04X: bswap_16_ref = 0x%04X, bswap_16 = 0x%04X - %s\n", vals_16[i], foo, bar, (foo == bar ? pass_str : fail_str));
 		count_test_result(foo == bar, result);
+#if defined(__reg_args)
+		bar = bswap_16_ra(vals_16[i]);
+		printf("0x%04X: bswap_16_ref = 0x%04X, bswap_16_ra = 0x%04X - %s\n", vals_16[i], foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+#endif
 	}
 
 	for(size_t i = 0; i < (sizeof(vals_32) / sizeof(vals_32[0])); i++) {
@@ -113,21 +130,115 @@ static void test_swap(test_result_t *result) {
 		printf("0x%08lX: bswap_32_ref = 0x%08lX, bswap_32 = 0x%08lX - %s\n", vals_32[i], foo, bar, (foo == bar ? pass_str : fail_str));
 		count_test_result(foo == bar, result);
 	}
+
+	// For the buffer functions, the reference and tested functions are each
+	// given their own copy of the test data. The element following the last
+	// one swapped is also compared, to check that nothing beyond the end of
+	// the buffer was touched.
+	for(size_t i = 0; i < (sizeof(lens) / sizeof(lens[0])); i++) {
+		uint16_t buf_foo[sizeof(vals_16) / sizeof(vals_16[0])], buf_bar[sizeof(vals_16) / sizeof(vals_16[0])];
+		bool ok = true;
+		for(size_t j = 0; j < (sizeof(vals_16) / sizeof(vals_16[0])); j++) buf_foo[j] = buf_bar[j] = vals_16[j];
+		bswap_16_buf_ref(buf_foo, lens[i]);
+		bswap_16_buf(buf_bar, lens[i]);
+		for(size_t j = 0; j <= lens[i]; j++) ok = ok && (buf_foo[j] == buf_bar[j]);
+		printf("count = %u: bswap_16_buf_ref vs. bswap_16_buf - %s\n", lens[i], (ok ? pass_str : fail_str));
+		count_test_result(ok, result);
+
+		ok = true;
+		for(size_t j = 0; j < (sizeof(vals_16) / sizeof(vals_16[0])); j++) buf_foo[j] = buf_bar[j] = 0;
+		bswap_16_buf_copy_ref(buf_foo, vals_16, lens[i]);
+		bswap_16_buf_copy(buf_bar, vals_16, lens[i]);
+		for(size_t j = 0; j <= lens[i]; j++) ok = ok && (buf_foo[j] == buf_bar[j]);
+		printf("count = %u: bswap_16_buf_copy_ref vs. bswap_16_buf_copy - %s\n", lens[i], (ok ? pass_str : fail_str));
+		count_test_result(ok, result);
+	}
+
+	for(size_t i = 0; i < (sizeof(lens) / sizeof(lens[0])); i++) {
+		uint32_t buf_foo[sizeof(vals_32) / sizeof(vals_32[0])], buf_bar[sizeof(vals_32) / sizeof(vals_32[0])];
+		bool ok = true;
+		for(size_t j = 0; j < (sizeof(vals_32) / sizeof(vals_32[0])); j++) buf_foo[j] = buf_bar[j] = vals_32[j];
+		bswap_32_buf_ref(buf_foo, lens[i]);
+		bswap_32_buf(buf_bar, lens[i]);
+		for(size_t j = 0; j <= lens[i]; j++) ok = ok && (buf_foo[j] == buf_bar[j]);
+		printf("count = %u: bswap_32_buf_ref vs. bswap_32_buf - %s\n", lens[i], (ok ? pass_str : fail_str));
+		count_test_result(ok, result);
+
+		ok = true;
+		for(size_t j = 0; j < (sizeof(vals_32) / sizeof(vals_32[0])); j++) buf_foo[j] = buf_bar[j] = 0;
+		bswap_32_buf_copy_ref(buf_foo, vals_32, lens[i]);
+		bswap_32_buf_copy(buf_bar, vals_32, lens[i]);
+		for(size_t j = 0; j <= lens[i]; j++) ok = ok && (buf_foo[j] == buf_bar[j]);
+		printf("count = %u: bswap_32_buf_copy_ref vs. bswap_32_buf_copy - %s\n", lens[i], (ok ? pass_str : fail_str));
+		count_test_result(ok, result);
+	}
 }
 
 static void benchmark_swap(void) {
 	static const uint8_t val_8 = 0xAB;
 	static const uint16_t val_16 = 0xAABB;
 	static const uint32_t val_32 = 0xAABBCCDDUL;
+	static uint16_t buf_16[32], dst_16[32];
+	static uint32_t buf_32[32], dst_32[32];
+
+	for(uint8_t i = 0; i < (sizeof(buf_16) / sizeof(buf_16[0])); i++) {
+		buf_16[i] = val_16 + i;
+		buf_32[i] = val_32 + i;
+	}
 
 	benchmark("swap_ref", swap_ref(val_8));
 	benchmark("swap", swap(val_8));
+#if defined(__reg_args)
+	benchmark("swap_ra", swap_ra(val_8));
+#endif
 
 	benchmark("bswap_16_ref", bswap_16_ref(val_16));
 	benchmark("bswap_16", bswap_16(val_16));
+#if defined(__reg_args)
+	benchmark("bswap_16_ra", bswap_16_ra(val_16));
+#endif
 
 	benchmark("bswap_32_ref", bswap_32_ref(val_32));
 	benchmark("bswap_32", bswap_32(val_32));
+
+	// Compare the buffer functions against a plain C loop calling bswap_16 or
+	// bswap_32 for each element. Only 1,000 iterations, as each covers a whole
+	// 32-element buffer; divide the cycle count by 32,000 for cycles per
+	// element.
+
+	benchmark_print_header("bswap_16 loop");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) {
+		for(uint8_t i = 0; i < (sizeof(buf_16) / sizeof(buf_16[0])); i++) buf_16[i] = bswap_16(buf_16[i]);
+	}
+	benchmark_marker_end();
+
+	benchmark_print_header("bswap_16_buf");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) bswap_16_buf(buf_16, (sizeof(buf_16) / sizeof(buf_16[0])));
+	benchmark_marker_end();
+
+	benchmark_print_header("bswap_16_buf_copy");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) bswap_16_buf_copy(dst_16, buf_16, (sizeof(buf_16) / sizeof(buf_16[0])));
+	benchmark_marker_end();
+
+	benchmark_print_header("bswap_32 loop");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) {
+		for(uint8_t i = 0; i < (sizeof(buf_32) / sizeof(buf_32[0])); i++) buf_32[i] = bswap_32(buf_32[i]);
+	}
+	benchmark_marker_end();
+
+	benchmark_print_header("bswap_32_buf");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) bswap_32_buf(buf_32, (sizeof(buf_32) / sizeof(buf_32[0])));
+	benchmark_marker_end();
+
+	benchmark_print_header("bswap_32_buf_copy");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) bswap_32_buf_copy(dst_32, buf_32, (sizeof(buf_32) / sizeof(buf_32[0])));
+	benchmark_marker_end();
 }
 
 static void test_reflect(test_result_t *result) {
@@ -140,12 +251,22 @@ static void test_reflect(test_result_t *result) {
 	static const uint32_t vals_32[] = {
 		0xAAAA5555UL, 0x33333333UL, 0x88888888UL, 0x00000000UL, 0xFFFFFFFFUL,
 	};
+	static const uint8_t buf[] = {
+		0xA5, 0x33, 0x88, 0x00, 0xFF, 0x01, 0x80, 0x12, 0x34, 0x56, 0x78, 0x9A,
+		0xBC, 0xDE, 0xF0, 0x0F,
+	};
+	static const uint16_t lens[] = { 0, 1, 7, sizeof(buf) };
 
 	for(size_t i = 0; i < (sizeof(vals_8) / sizeof(vals_8[0])); i++) {
 		uint8_t foo = reflect_8_ref(vals_8[i]);
 		uint8_t bar = reflect_8(vals_8[i]);
 		printf("0x%02X: reflect_8_ref = 0x%02X, swap = 0x%02X - %s\n", vals_8[i], foo, bar, (foo == bar ? pass_str : fail_str));
 		count_test_result(foo == bar, result);
+#if defined(__reg_args)
+		bar = reflect_8_ra(vals_8[i]);
+		printf("0x%02X: reflect_8_ref = 0x%02X, reflect_8_ra = 0x%02X - %s\n", vals_8[i], foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+#endif
 	}
 
 	for(size_t i = 0; i < (sizeof(vals_16) / sizeof(vals_16[0])); i++) {
@@ -153,6 +274,11 @@ static void test_reflect(test_result_t *result) {
 		uint16_t bar = reflect_16(vals_16[i]);
 		printf("0x%04X: reflect_16_ref = 0x%04X, reflect_16 = 0x%04X - %s\n", vals_16[i], foo, bar, (foo == bar ? pass_str : fail_str));
 		count_test_result(foo == bar, result);
+#if defined(__reg_args)
+		bar = reflect_16_ra(vals_16[i]);
+		printf("0x%04X: reflect_16_ref = 0x%04X, reflect_16_ra = 0x%04X - %s\n", vals_16[i], foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+#endif
 	}
 
 	for(size_t i = 0; i < (sizeof(vals_32) / sizeof(vals_32[0])); i++) {
@@ -161,21 +287,73 @@ static void test_reflect(test_result_t *result) {
 		printf("0x%08lX: reflect_32_ref = 0x%08lX, reflect_32 = 0x%08lX - %s\n", vals_32[i], foo, bar, (foo == bar ? pass_str : fail_str));
 		count_test_result(foo == bar, result);
 	}
+
+	// Both separate and same (i.e. in-place) source and destination are tested.
+	// For the former, the byte following the last one reflected is also
+	// compared, to check that nothing beyond the end of the destination buffer
+	// was touched.
+	for(size_t i = 0; i < (sizeof(lens) / sizeof(lens[0])); i++) {
+		uint8_t buf_foo[sizeof(buf) + 1], buf_bar[sizeof(buf) + 1];
+		bool ok = true;
+		for(size_t j = 0; j < sizeof(buf_foo); j++) buf_foo[j] = buf_bar[j] = 0;
+		reflect_buf_ref(buf_foo, buf, lens[i]);
+		reflect_buf(buf_bar, buf, lens[i]);
+		for(size_t j = 0; j <= lens[i]; j++) ok = ok && (buf_foo[j] == buf_bar[j]);
+		printf("len = %u: reflect_buf_ref vs. reflect_buf - %s\n", lens[i], (ok ? pass_str : fail_str));
+		count_test_result(ok, result);
+
+		ok = true;
+		for(size_t j = 0; j < sizeof(buf); j++) buf_bar[j] = buf[j];
+		reflect_buf(buf_bar, buf_bar, lens[i]);
+		for(size_t j = 0; j < lens[i]; j++) ok = ok && (buf_foo[j] == buf_bar[j]);
+		printf("len = %u: reflect_buf_ref vs. reflect_buf (in-place) - %s\n", lens[i], (ok ? pass_str : fail_str));
+		count_test_result(ok, result);
+	}
 }
 
 static void benchmark_reflect(void) {
 	static const uint8_t val_8 = 0xA5;
 	static const uint16_t val_16 = 0xAA55;
 	static const uint32_t val_32 = 0xAAAA5555UL;
+	static uint8_t buf[64], dst[64];
 
 	benchmark("reflect_8_ref", reflect_8_ref(val_8));
 	benchmark("reflect_8", reflect_8(val_8));
+#if defined(__reg_args)
+	benchmark("reflect_8_ra", reflect_8_ra(val_8));
+#endif
 
 	benchmark("reflect_16_ref", reflect_16_ref(val_16));
 	benchmark("reflect_16", reflect_16(val_16));
+#if defined(__reg_args)
+	benchmark("reflect_16_ra", reflect_16_ra(val_16));
+#endif
 
 	benchmark("reflect_32_ref", reflect_32_ref(val_32));
 	benchmark("reflect_32", reflect_32(val_32));
+
+	for(size_t i = 0; i < sizeof(buf); i++) buf[i] = (uint8_t)(i * 37);
+
+	// Compare against a plain C loop over the buffer calling reflect_8 for
+	// each byte. Only 1,000 iterations, as each covers a whole 64-byte buffer;
+	// divide the cycle count by 64,000 for cycles per byte.
+
+	benchmark_print_header("reflect_buf_ref");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) reflect_buf_ref(dst, buf, sizeof(buf));
+	benchmark_marker_end();
+
+	benchmark_print_header("reflect_8 loop");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) {
+		for(uint8_t i = 0; i < sizeof(buf); i++) dst[i] = reflect_8(buf[i]);
+	}
+	benchmark_marker_end();
+
+	benchmark_print_header("reflect_buf");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) reflect_buf(dst, buf, sizeof(buf));
+	benchmark_marker_end();
 }
 
 static void test_pop_count(test_result_t *result) {
@@ -205,6 +383,11 @@ static void test_pop_count(test_result_t *result) {
 		uint8_t bar = pop_count_8(vals_8[i]);
 		printf("0x%02X: pop_count_8_ref = %u, pop_count_8 = %u - %s\n", vals_8[i], foo, bar, (foo == bar ? pass_str : fail_str));
 		count_test_result(foo == bar, result);
+#if defined(__reg_args)
+		bar = pop_count_8_ra(vals_8[i]);
+		printf("0x%02X: pop_count_8_ref = %u, pop_count_8_ra = %u - %s\n", vals_8[i], foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+#endif
 	}
 
 	for(size_t i = 0; i < (sizeof(vals_16) / sizeof(vals_16[0])); i++) {
@@ -212,6 +395,11 @@ static void test_pop_count(test_result_t *result) {
 		uint8_t bar = pop_count_16(vals_16[i]);
 		printf("0x%04X: pop_count_16_ref = %u, pop_count_16 = %u - %s\n", vals_16[i], foo, bar, (foo == bar ? pass_str : fail_str));
 		count_test_result(foo == bar, result);
+#if defined(__reg_args)
+		bar = pop_count_16_ra(vals_16[i]);
+		printf("0x%04X: pop_count_16_ref = %u, pop_count_16_ra = %u - %s\n", vals_16[i], foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+#endif
 	}
 
 	for(size_t i = 0; i < (sizeof(vals_32) / sizeof(vals_32[0])); i++) {
@@ -229,14 +417,93 @@ static void benchmark_pop_count(void) {
 
 	benchmark("pop_count_8_ref", pop_count_8_ref(val_8));
 	benchmark("pop_count_8", pop_count_8(val_8));
+#if defined(__reg_args)
+	benchmark("pop_count_8_ra", pop_count_8_ra(val_8));
+#endif
 
 	benchmark("pop_count_16_ref", pop_count_16_ref(val_16));
 	benchmark("pop_count_16", pop_count_16(val_16));
+#if defined(__reg_args)
+	benchmark("pop_count_16_ra", pop_count_16_ra(val_16));
+#endif
 
 	benchmark("pop_count_32_ref", pop_count_32_ref(val_32));
 	benchmark("pop_count_32", pop_count_32(val_32));
 }
 
+static void test_pop_count_buf(test_result_t *result) {
+	static const uint8_t buf_a[] = {
+		0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF, 0xFE, 0xFC, 0xF8,
+		0xF0, 0xE0, 0xC0, 0x80, 0xAA, 0x55, 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC,
+		0xDE, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	};
+	static const uint8_t buf_b[] = {
+		0xFF, 0x01, 0x30, 0x70, 0xF0, 0x1F, 0x00, 0x7F, 0x00, 0xEF, 0xCF, 0x8F,
+		0x0F, 0x0E, 0x0C, 0x08, 0x55, 0xAA, 0x21, 0x43, 0x65, 0x87, 0xA9, 0xCB,
+		0xED, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	};
+	static const uint16_t lens[] = { 0, 1, 2, 7, 16, 33, sizeof(buf_a) };
+
+	for(size_t i = 0; i < (sizeof(lens) / sizeof(lens[0])); i++) {
+		uint16_t foo = pop_count_buf_ref(buf_a, lens[i]);
+		uint16_t bar = pop_count_buf(buf_a, lens[i]);
+		printf("len = %u: pop_count_buf_ref = %u, pop_count_buf = %u - %s\n", lens[i], foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+	}
+
+	for(size_t i = 0; i < (sizeof(lens) / sizeof(lens[0])); i++) {
+		uint16_t foo = hamming_buf_ref(buf_a, buf_b, lens[i]);
+		uint16_t bar = hamming_buf(buf_a, buf_b, lens[i]);
+		printf("len = %u: hamming_buf_ref = %u, hamming_buf = %u - %s\n", lens[i], foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+	}
+}
+
+static void benchmark_pop_count_buf(void) {
+	static uint8_t buf_a[64], buf_b[64];
+	uint16_t c;
+
+	for(size_t i = 0; i < sizeof(buf_a); i++) {
+		buf_a[i] = (uint8_t)(i * 37);
+		buf_b[i] = (uint8_t)(i * 91);
+	}
+
+	// Compare against a plain C loop over the buffer calling pop_count_8 for
+	// each byte. Only 1,000 iterations, as each covers a whole 64-byte buffer.
+
+	benchmark_print_header("pop_count_buf_ref");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) pop_count_buf_ref(buf_a, sizeof(buf_a));
+	benchmark_marker_end();
+
+	benchmark_print_header("pop_count_8 loop");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) {
+		c = 0;
+		for(uint8_t i = 0; i < sizeof(buf_a); i++) c += pop_count_8(buf_a[i]);
+	}
+	benchmark_marker_end();
+
+	benchmark_print_header("pop_count_buf");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) pop_count_buf(buf_a, sizeof(buf_a));
+	benchmark_marker_end();
+
+	benchmark_print_header("hamming_buf_ref");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) hamming_buf_ref(buf_a, buf_b, sizeof(buf_a));
+	benchmark_marker_end();
+
+	benchmark_print_header("hamming_buf");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) hamming_buf(buf_a, buf_b, sizeof(buf_a));
+	benchmark_marker_end();
+
+	(void)c;
+}
+
 static void test_ctz_clz_ffs(test_result_t *result) {
 	static const uint8_t vals_8[] = {
 		0x00, 0x01, 0x10, 0xFF, 0x0E, 0x0C, 0x08, 0xE0, 0xC0, 0x80, 0x5A, 0x88,
@@ -259,14 +526,29 @@ static void test_ctz_clz_ffs(test_result_t *result) {
 		bar = ctz_8(vals_8[i]);
 		printf("  ctz_8_ref = %u, ctz_8 = %u - %s\n", foo, bar, (foo == bar ? pass_str : fail_str));
 		count_test_result(foo == bar, result);
+#if defined(__reg_args)
+		bar = ctz_8_ra(vals_8[i]);
+		printf("  ctz_8_ref = %u, ctz_8_ra = %u - %s\n", foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+#endif
 		foo = clz_8_ref(vals_8[i]);
 		bar = clz_8(vals_8[i]);
 		printf("  clz_8_ref = %u, clz_8 = %u - %s\n", foo, bar, (foo == bar ? pass_str : fail_str));
 		count_test_result(foo == bar, result);
+#if defined(__reg_args)
+		bar = clz_8_ra(vals_8[i]);
+		printf("  clz_8_ref = %u, clz_8_ra = %u - %s\n", foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+#endif
 		foo = ffs_8_ref(vals_8[i]);
 		bar = ffs_8(vals_8[i]);
 		printf("  ffs_8_ref = %u, ffs_8 = %u - %s\n", foo, bar, (foo == bar ? pass_str : fail_str));
 		count_test_result(foo == bar, result);
+#if defined(__reg_args)
+		bar = ffs_8_ra(vals_8[i]);
+		printf("  ffs_8_ref = %u, ffs_8_ra = %u - %s\n", foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+#endif
 	}
 
 	for(size_t i = 0; i < (sizeof(vals_16) / sizeof(vals_16[0])); i++) {
@@ -276,14 +558,29 @@ static void test_ctz_clz_ffs(test_result_t *result) {
 		bar = ctz_16(vals_16[i]);
 		printf("  ctz_16_ref = %u, ctz_16 = %u - %s\n", foo, bar, (foo == bar ? pass_str : fail_str));
 		count_test_result(foo == bar, result);
+#if defined(__reg_args)
+		bar = ctz_16_ra(vals_16[i]);
+		printf("  ctz_16_ref = %u, ctz_16_ra = %u - %s\n", foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+#endif
 		foo = clz_16_ref(vals_16[i]);
 		bar = clz_16(vals_16[i]);
 		printf("  clz_16_ref = %u, clz_16 = %u - %s\n", foo, bar, (foo == bar ? pass_str : fail_str));
 		count_test_result(foo == bar, result);
+#if defined(__reg_args)
+		bar = clz_16_ra(vals_16[i]);
+		printf("  clz_16_ref = %u, clz_16_ra = %u - %s\n", foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+#endif
 		foo = ffs_16_ref(vals_16[i]);
 		bar = ffs_16(vals_16[i]);
 		printf("  ffs_16_ref = %u, ffs_16 = %u - %s\n", foo, bar, (foo == bar ? pass_str : fail_str));
 		count_test_result(foo == bar, result);
+#if defined(__reg_args)
+		bar = ffs_16_ra(vals_16[i]);
+		printf("  ffs_16_ref = %u, ffs_16_ra = %u - %s\n", foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+#endif
 	}
 
 	for(size_t i = 0; i < (sizeof(vals_32) / sizeof(vals_32[0])); i++) {
@@ -304,6 +601,89 @@ static void test_ctz_clz_ffs(test_result_t *result) {
 	}
 }
 
+static void test_bitmap(test_result_t *result) {
+	static const uint8_t bitmaps[][32] = {
+		{ 0 },
+		{ [0] = 0x01 },
+		{ [0] = 0x80, [31] = 0x01 },
+		{ [15] = 0x10 },
+		{ [16] = 0x24, [17] = 0x81 },
+		{ [31] = 0x80 },
+		{
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		},
+	};
+	static const uint16_t lens[] = { 0, 1, 16, 17, 32 };
+	static const uint16_t positions[] = { 0, 1, 7, 8, 120, 129, 255, 256 };
+
+	for(size_t i = 0; i < (sizeof(bitmaps) / sizeof(bitmaps[0])); i++) {
+		for(size_t j = 0; j < (sizeof(lens) / sizeof(lens[0])); j++) {
+			uint16_t foo, bar;
+			printf("bitmap %u, len = %u:\n", i, lens[j]);
+			foo = ffs_bitmap_ref(bitmaps[i], lens[j]);
+			bar = ffs_bitmap(bitmaps[i], lens[j]);
+			printf("  ffs_bitmap_ref = %u, ffs_bitmap = %u - %s\n", foo, bar, (foo == bar ? pass_str : fail_str));
+			count_test_result(foo == bar, result);
+			foo = fls_bitmap_ref(bitmaps[i], lens[j]);
+			bar = fls_bitmap(bitmaps[i], lens[j]);
+			printf("  fls_bitmap_ref = %u, fls_bitmap = %u - %s\n", foo, bar, (foo == bar ? pass_str : fail_str));
+			count_test_result(foo == bar, result);
+			for(size_t k = 0; k < (sizeof(positions) / sizeof(positions[0])); k++) {
+				foo = ffs_bitmap_next_ref(bitmaps[i], lens[j], positions[k]);
+				bar = ffs_bitmap_next(bitmaps[i], lens[j], positions[k]);
+				printf("  pos = %u: ffs_bitmap_next_ref = %u, ffs_bitmap_next = %u - %s\n", positions[k], foo, bar, (foo == bar ? pass_str : fail_str));
+				count_test_result(foo == bar, result);
+			}
+		}
+	}
+}
+
+static void benchmark_bitmap(void) {
+	// Bitmaps are 256 bits, held as 32-bit words so that the whole-bitmap
+	// functions can be compared against a plain C loop calling ffs_32 for
+	// each word in turn. The sparse bitmap has a single bit set in the middle,
+	// and the dense bitmap has all bits set.
+	static uint32_t sparse[8], dense[8];
+	uint16_t n;
+
+	sparse[4] = 0x00010000UL;
+	for(uint8_t i = 0; i < (sizeof(dense) / sizeof(dense[0])); i++) dense[i] = 0xFFFFFFFFUL;
+
+	benchmark_print_header("ffs_32 loop (sparse)");
+	n = 10000;
+	benchmark_marker_start();
+	while(n--) {
+		for(uint8_t i = 0; i < (sizeof(sparse) / sizeof(sparse[0])); i++) {
+			if(ffs_32(sparse[i])) break;
+		}
+	}
+	benchmark_marker_end();
+
+	benchmark("ffs_bitmap_ref (sparse)", ffs_bitmap_ref((const uint8_t *)sparse, sizeof(sparse)));
+	benchmark("ffs_bitmap (sparse)", ffs_bitmap((const uint8_t *)sparse, sizeof(sparse)));
+	benchmark("ffs_bitmap_next (sparse)", ffs_bitmap_next((const uint8_t *)sparse, sizeof(sparse), 1));
+	benchmark("fls_bitmap_ref (sparse)", fls_bitmap_ref((const uint8_t *)sparse, sizeof(sparse)));
+	benchmark("fls_bitmap (sparse)", fls_bitmap((const uint8_t *)sparse, sizeof(sparse)));
+
+	benchmark_print_header("ffs_32 loop (dense)");
+	n = 10000;
+	benchmark_marker_start();
+	while(n--) {
+		for(uint8_t i = 0; i < (sizeof(dense) / sizeof(dense[0])); i++) {
+			if(ffs_32(dense[i])) break;
+		}
+	}
+	benchmark_marker_end();
+
+	benchmark("ffs_bitmap_ref (dense)", ffs_bitmap_ref((const uint8_t *)dense, sizeof(dense)));
+	benchmark("ffs_bitmap (dense)", ffs_bitmap((const uint8_t *)dense, sizeof(dense)));
+	benchmark("ffs_bitmap_next (dense)", ffs_bitmap_next((const uint8_t *)dense, sizeof(dense), 129));
+	benchmark("fls_bitmap_ref (dense)", fls_bitmap_ref((const uint8_t *)dense, sizeof(dense)));
+	benchmark("fls_bitmap (dense)", fls_bitmap((const uint8_t *)dense, sizeof(dense)));
+}
+
 static void benchmark_ctz_clz_ffs(void) {
 	static const uint8_t val_8 = 0x18;
 	static const uint16_t val_16 = 0x0180;
@@ -311,32 +691,144 @@ static void benchmark_ctz_clz_ffs(void) {
 
 	benchmark("ctz_8_ref", ctz_8_ref(val_8));
 	benchmark("ctz_8", ctz_8(val_8));
+#if defined(__reg_args)
+	benchmark("ctz_8_ra", ctz_8_ra(val_8));
+#endif
 
 	benchmark("ctz_16_ref", ctz_16_ref(val_16));
 	benchmark("ctz_16", ctz_16(val_16));
+#if defined(__reg_args)
+	benchmark("ctz_16_ra", ctz_16_ra(val_16));
+#endif
 
 	benchmark("ctz_32_ref", ctz_32_ref(val_32));
 	benchmark("ctz_32", ctz_32(val_32));
 
 	benchmark("clz_8_ref", clz_8_ref(val_8));
 	benchmark("clz_8", clz_8(val_8));
+#if defined(__reg_args)
+	benchmark("clz_8_ra", clz_8_ra(val_8));
+#endif
 
 	benchmark("clz_16_ref", clz_16_ref(val_16));
 	benchmark("clz_16", clz_16(val_16));
+#if defined(__reg_args)
+	benchmark("clz_16_ra", clz_16_ra(val_16));
+#endif
 
 	benchmark("clz_32_ref", clz_32_ref(val_32));
 	benchmark("clz_32", clz_32(val_32));
 
+	// Also benchmark the equivalent of ffs derived from ctz, for comparison
+	// with the native implementations.
+
 	benchmark("ffs_8_ref", ffs_8_ref(val_8));
+	benchmark("ffs_8 (via ctz_8)", (val_8 ? ctz_8(val_8) + 1 : 0));
 	benchmark("ffs_8", ffs_8(val_8));
+#if defined(__reg_args)
+	benchmark("ffs_8_ra", ffs_8_ra(val_8));
+#endif
 
 	benchmark("ffs_16_ref", ffs_16_ref(val_16));
+	benchmark("ffs_16 (via ctz_16)", (val_16 ? ctz_16(val_16) + 1 : 0));
 	benchmark("ffs_16", ffs_16(val_16));
+#if defined(__reg_args)
+	benchmark("ffs_16_ra", ffs_16_ra(val_16));
+#endif
 
 	benchmark("ffs_32_ref", ffs_32_ref(val_32));
+	benchmark("ffs_32 (via ctz_32)", (val_32 ? ctz_32(val_32) + 1 : 0));
 	benchmark("ffs_32", ffs_32(val_32));
 }
 
+static void test_bitset(test_result_t *result) {
+	static uint8_t storage[BITSET_STORAGE_SIZE(20)];
+	static const uint16_t frees[] = { 15, 3, 19, 7 };
+	static const uint16_t fragmented[] = { 3, 7, 15, 19 };
+	bitset_t set;
+	uint16_t foo, bar;
+
+	bitset_init(&set, storage, 20);
+	foo = 20;
+	bar = bitset_count_free(&set);
+	printf("init: bitset_count_free = %u, expected %u - %s\n", bar, foo, (foo == bar ? pass_str : fail_str));
+	count_test_result(foo == bar, result);
+
+	// Allocate every slot. They should be allocated lowest first, and after
+	// that allocation should fail.
+	for(foo = 0; foo < 20; foo++) {
+		bar = bitset_alloc(&set);
+		printf("exhaust: bitset_alloc = %u, expected %u - %s\n", bar, foo, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+	}
+	foo = BITSET_NONE;
+	bar = bitset_alloc(&set);
+	printf("exhausted: bitset_alloc = 0x%04X, expected 0x%04X - %s\n", bar, foo, (foo == bar ? pass_str : fail_str));
+	count_test_result(foo == bar, result);
+	foo = 0;
+	bar = bitset_count_free(&set);
+	printf("exhausted: bitset_count_free = %u, expected %u - %s\n", bar, foo, (foo == bar ? pass_str : fail_str));
+	count_test_result(foo == bar, result);
+
+	// Free some slots out of order (plus an out-of-range index, which should
+	// be ignored). They should be re-allocated lowest first.
+	for(size_t i = 0; i < (sizeof(frees) / sizeof(frees[0])); i++) bitset_free(&set, frees[i]);
+	bitset_free(&set, 20);
+	foo = sizeof(frees) / sizeof(frees[0]);
+	bar = bitset_count_free(&set);
+	printf("fragmented: bitset_count_free = %u, expected %u - %s\n", bar, foo, (foo == bar ? pass_str : fail_str));
+	count_test_result(foo == bar, result);
+	for(size_t i = 0; i < (sizeof(fragmented) / sizeof(fragmented[0])); i++) {
+		foo = fragmented[i];
+		bar = bitset_alloc(&set);
+		printf("fragmented: bitset_alloc = %u, expected %u - %s\n", bar, foo, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+	}
+	foo = BITSET_NONE;
+	bar = bitset_alloc(&set);
+	printf("fragmented: bitset_alloc = 0x%04X, expected 0x%04X - %s\n", bar, foo, (foo == bar ? pass_str : fail_str));
+	count_test_result(foo == bar, result);
+
+	// Free every other slot, then allocate one and free it again; the same
+	// slot should be re-allocated each time.
+	for(uint16_t i = 0; i < 20; i += 2) bitset_free(&set, i);
+	foo = 10;
+	bar = bitset_count_free(&set);
+	printf("alternate: bitset_count_free = %u, expected %u - %s\n", bar, foo, (foo == bar ? pass_str : fail_str));
+	count_test_result(foo == bar, result);
+	for(uint8_t i = 0; i < 2; i++) {
+		foo = 0;
+		bar = bitset_alloc(&set);
+		printf("alternate: bitset_alloc = %u, expected %u - %s\n", bar, foo, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+		bitset_free(&set, bar);
+	}
+}
+
+static void benchmark_bitset(void) {
+	static uint8_t storage[BITSET_STORAGE_SIZE(256)];
+	bitset_t set;
+
+	// Steady-state: allocate and immediately free a slot in a partly-used
+	// pool, so the search begins at the lowest free slot each time.
+	bitset_init(&set, storage, 256);
+	for(uint8_t i = 0; i < 100; i++) bitset_alloc(&set);
+	benchmark("bitset_alloc + bitset_free", bitset_free(&set, bitset_alloc(&set)));
+
+	// Fill an entire 256-slot pool. Only 100 iterations, as each does 256
+	// allocations; divide the cycle count by 25,600 for cycles per allocation
+	// (which includes a small share for re-initialising the pool).
+	benchmark_print_header("bitset_alloc (fill 256 slots)");
+	benchmark_marker_start();
+	for(uint8_t n = 100; n; n--) {
+		bitset_init(&set, storage, 256);
+		for(uint16_t i = 256; i; i--) bitset_alloc(&set);
+	}
+	benchmark_marker_end();
+
+	benchmark("bitset_count_free", bitset_count_free(&set));
+}
+
 static void test_rotate(test_result_t *result) {
 	static const uint8_t vals_8[] = {
 		0x80, 0x01, 0xFF, 0x00, 0xDD,
@@ -375,6 +867,11 @@ static void test_rotate(test_result_t *result) {
 			uint16_t bar = rotate_left_16(vals_16[i], j);
 			printf("  %2u: rotate_left_16_ref = 0x%04X, rotate_left_16 = 0x%04X - %s\n", j, foo, bar, (foo == bar ? pass_str : fail_str));
 			count_test_result(foo == bar, result);
+#if defined(__reg_args)
+			bar = rotate_left_16_ra(vals_16[i], j);
+			printf("  %2u: rotate_left_16_ref = 0x%04X, rotate_left_16_ra = 0x%04X - %s\n", j, foo, bar, (foo == bar ? pass_str : fail_str));
+			count_test_result(foo == bar, result);
+#endif
 		}
 	}
 
@@ -385,6 +882,11 @@ static void test_rotate(test_result_t *result) {
 			uint16_t bar = rotate_right_16(vals_16[i], j);
 			printf("  %2u: rotate_right_16_ref = 0x%04X, rotate_right_16 = 0x%04X - %s\n", j, foo, bar, (foo == bar ? pass_str : fail_str));
 			count_test_result(foo == bar, result);
+#if defined(__reg_args)
+			bar = rotate_right_16_ra(vals_16[i], j);
+			printf("  %2u: rotate_right_16_ref = 0x%04X, rotate_right_16_ra = 0x%04X - %s\n", j, foo, bar, (foo == bar ? pass_str : fail_str));
+			count_test_result(foo == bar, result);
+#endif
 		}
 	}
 
@@ -421,6 +923,9 @@ static void benchmark_rotate(void) {
 
 	benchmark("rotate_left_16_ref", rotate_left_16_ref(val_16, rotate_count(val_16)));
 	benchmark("rotate_left_16", rotate_left_16(val_16, rotate_count(val_16)));
+#if defined(__reg_args)
+	benchmark("rotate_left_16_ra", rotate_left_16_ra(val_16, rotate_count(val_16)));
+#endif
 
 	benchmark("rotate_left_32_ref", rotate_left_32_ref(val_32, rotate_count(val_32)));
 	benchmark("rotate_left_32", rotate_left_32(val_32, rotate_count(val_32)));
@@ -430,6 +935,9 @@ static void benchmark_rotate(void) {
 
 	benchmark("rotate_right_16_ref", rotate_right_16_ref(val_16, rotate_count(val_16)));
 	benchmark("rotate_right_16", rotate_right_16(val_16, rotate_count(val_16)));
+#if defined(__reg_args)
+	benchmark("rotate_right_16_ra", rotate_right_16_ra(val_16, rotate_count(val_16)));
+#endif
 
 	benchmark("rotate_right_32_ref", rotate_right_32_ref(val_32, rotate_count(val_32)));
 	benchmark("rotate_right_32", rotate_right_32(val_32, rotate_count(val_32)));
@@ -437,23 +945,98 @@ static void benchmark_rotate(void) {
 #undef rotate_count
 }
 
-/*
 static void benchmark_rotate_linearity(void) {
+	static const uint8_t val_8 = 0x55;
+	static const uint16_t val_16 = 0x5555;
 	static const uint32_t val_32 = 0x55555555UL;
 
-	for(uint8_t i = 0; i < 35; i++) {
-		printf("%u\n", i);
+	// Time a single call for every rotation count, so that the (non-)linearity
+	// of execution time with respect to count can be seen.
+
+	for(uint8_t i = 0; i < 11; i++) {
+		printf("%s: rotate_left_8_ref (count = %u)\n", bench_str, i);
+		benchmark_marker_start();
+		rotate_left_8_ref(val_8, i);
+		benchmark_marker_end();
+
+		printf("%s: rotate_left_8 (count = %u)\n", bench_str, i);
+		benchmark_marker_start();
+		rotate_left_8(val_8, i);
+		benchmark_marker_end();
+	}
+
+	for(uint8_t i = 0; i < 11; i++) {
+		printf("%s: rotate_right_8_ref (count = %u)\n", bench_str, i);
+		benchmark_marker_start();
+		rotate_right_8_ref(val_8, i);
+		benchmark_marker_end();
+
+		printf("%s: rotate_right_8 (count = %u)\n", bench_str, i);
+		benchmark_marker_start();
+		rotate_right_8(val_8, i);
+		benchmark_marker_end();
+	}
+
+	for(uint8_t i = 0; i < 19; i++) {
+		printf("%s: rotate_left_16_ref (count = %u)\n", bench_str, i);
+		benchmark_marker_start();
+		rotate_left_16_ref(val_16, i);
+		benchmark_marker_end();
+
+		printf("%s: rotate_left_16 (count = %u)\n", bench_str, i);
+		benchmark_marker_start();
+		rotate_left_16(val_16, i);
+		benchmark_marker_end();
+#if defined(__reg_args)
+		printf("%s: rotate_left_16_ra (count = %u)\n", bench_str, i);
+		benchmark_marker_start();
+		rotate_left_16_ra(val_16, i);
+		benchmark_marker_end();
+#endif
+	}
+
+	for(uint8_t i = 0; i < 19; i++) {
+		printf("%s: rotate_right_16_ref (count = %u)\n", bench_str, i);
+		benchmark_marker_start();
+		rotate_right_16_ref(val_16, i);
+		benchmark_marker_end();
+
+		printf("%s: rotate_right_16 (count = %u)\n", bench_str, i);
+		benchmark_marker_start();
+		rotate_right_16(val_16, i);
+		benchmark_marker_end();
+#if defined(__reg_args)
+		printf("%s: rotate_right_16_ra (count = %u)\n", bench_str, i);
+		benchmark_marker_start();
+		rotate_right_16_ra(val_16, i);
+		benchmark_marker_end();
+#endif
+	}
 
+	for(uint8_t i = 0; i < 35; i++) {
+		printf("%s: rotate_left_32_ref (count = %u)\n", bench_str, i);
 		benchmark_marker_start();
 		rotate_left_32_ref(val_32, i);
 		benchmark_marker_end();
 
+		printf("%s: rotate_left_32 (count = %u)\n", bench_str, i);
 		benchmark_marker_start();
 		rotate_left_32(val_32, i);
 		benchmark_marker_end();
 	}
+
+	for(uint8_t i = 0; i < 35; i++) {
+		printf("%s: rotate_right_32_ref (count = %u)\n", bench_str, i);
+		benchmark_marker_start();
+		rotate_right_32_ref(val_32, i);
+		benchmark_marker_end();
+
+		printf("%s: rotate_right_32 (count = %u)\n", bench_str, i);
+		benchmark_marker_start();
+		rotate_right_32(val_32, i);
+		benchmark_marker_end();
+	}
 }
-*/
 
 static void test_div(test_result_t *result) {
 	static const struct {
@@ -490,6 +1073,29 @@ static void test_div(test_result_t *result) {
 		{ 65535, 10000 },
 		{ 65535, 65535 },
 	};
+	static const struct {
+		int32_t a;
+		int32_t b;
+	} vals_s32[] = {
+		{ 0L, 1L },
+		{ 1L, 1L },
+		{ 1L, 2L },
+		{ -1L, 1L },
+		{ -1L, 2L },
+		{ 1L, -1L },
+		{ 1L, -2L },
+		{ -1L, -1L },
+		{ -1L, -2L },
+		{ 1000000L, 7L },
+		{ -1000000L, 7L },
+		{ 1000000L, -7L },
+		{ -1000000L, -7L },
+		{ 2147483647L, 100000L },
+		{ -2147483647L - 1L, 100000L },
+		{ -2147483647L - 1L, 1L },
+		{ -2147483647L - 1L, -2147483647L - 1L },
+		{ 100000L, -2147483647L - 1L },
+	};
 	static const struct {
 		uint32_t a;
 		uint32_t b;
@@ -507,10 +1113,55 @@ static void test_div(test_result_t *result) {
 		{ 4294967295UL, 100000UL },
 		{ 100000UL, 4294967295UL },
 		{ 4294967295UL, 4294967295UL },
+		{ 4294967295UL, 10UL },
+		{ 123456789UL, 60UL },
+		{ 4294967295UL, 255UL },
+		{ 4294967295UL, 256UL },
+		{ 4294967295UL, 1000UL },
+		{ 4294967295UL, 65535UL },
+		{ 65535UL, 65536UL },
+		{ 65536UL, 65535UL },
+		{ 86490UL, 86491UL },
+		{ 86491UL, 86491UL },
+		{ 1000000UL, 86491UL },
+		{ 4294967295UL, 65536UL },
+		{ 4294967295UL, 2147483648UL },
+	};
+	static const struct {
+		uint16_t a;
+		uint8_t b;
+	} vals_u16_u8[] = {
+		{ 0, 1 },
+		{ 1, 1 },
+		{ 1, 2 },
+		{ 1000, 10 },
+		{ 12345, 16 },
+		{ 65535, 1 },
+		{ 65535, 3 },
+		{ 65535, 255 },
+		{ 254, 255 },
+	};
+	static const struct {
+		uint32_t a;
+		uint8_t b;
+	} vals_u32_u8[] = {
+		{ 0UL, 1 },
+		{ 1UL, 1 },
+		{ 1UL, 2 },
+		{ 1000000UL, 10 },
+		{ 123456789UL, 60 },
+		{ 2147483647UL, 16 },
+		{ 4294967295UL, 1 },
+		{ 4294967295UL, 7 },
+		{ 4294967295UL, 255 },
+		{ 254UL, 255 },
 	};
 	div_s16_t foo_s16, bar_s16;
 	div_u16_t foo_u16, bar_u16;
+	div_s32_t foo_s32, bar_s32;
 	div_u32_t foo_u32, bar_u32;
+	div_u16_u8_t foo_u16_u8, bar_u16_u8;
+	div_u32_u8_t foo_u32_u8, bar_u32_u8;
 	bool pass_fail;
 
 	for(size_t i = 0; i < (sizeof(vals_s16) / sizeof(vals_s16[0])); i++) {
@@ -547,6 +1198,23 @@ static void test_div(test_result_t *result) {
 		count_test_result(pass_fail, result);
 	}
 
+	for(size_t i = 0; i < (sizeof(vals_s32) / sizeof(vals_s32[0])); i++) {
+		div_s32_ref(vals_s32[i].a, vals_s32[i].b, &foo_s32);
+		div_s32(vals_s32[i].a, vals_s32[i].b, &bar_s32);
+		pass_fail = (foo_s32.quot == bar_s32.quot && foo_s32.rem == bar_s32.rem && ((bar_s32.quot * vals_s32[i].b) + bar_s32.rem) == vals_s32[i].a);
+		printf(
+			"%ld, %ld: div_s32_ref = { quot = %ld, rem = %ld }, div_s32 = { quot = %ld, rem = %ld } - %s\n",
+			vals_s32[i].a,
+			vals_s32[i].b,
+			foo_s32.quot,
+			foo_s32.rem,
+			bar_s32.quot,
+			bar_s32.rem,
+			(pass_fail ? pass_str : fail_str)
+		);
+		count_test_result(pass_fail, result);
+	}
+
 	for(size_t i = 0; i < (sizeof(vals_u32) / sizeof(vals_u32[0])); i++) {
 		div_u32_ref(vals_u32[i].a, vals_u32[i].b, &foo_u32);
 		div_u32(vals_u32[i].a, vals_u32[i].b, &bar_u32);
@@ -563,6 +1231,104 @@ static void test_div(test_result_t *result) {
 		);
 		count_test_result(pass_fail, result);
 	}
+
+	for(size_t i = 0; i < (sizeof(vals_u16_u8) / sizeof(vals_u16_u8[0])); i++) {
+		div_u16_u8_ref(vals_u16_u8[i].a, vals_u16_u8[i].b, &foo_u16_u8);
+		div_u16_u8(vals_u16_u8[i].a, vals_u16_u8[i].b, &bar_u16_u8);
+		pass_fail = (foo_u16_u8.quot == bar_u16_u8.quot && foo_u16_u8.rem == bar_u16_u8.rem && ((bar_u16_u8.quot * vals_u16_u8[i].b) + bar_u16_u8.rem) == vals_u16_u8[i].a);
+		printf(
+			"%u, %u: div_u16_u8_ref = { quot = %u, rem = %u }, div_u16_u8 = { quot = %u, rem = %u } - %s\n",
+			vals_u16_u8[i].a,
+			vals_u16_u8[i].b,
+			foo_u16_u8.quot,
+			foo_u16_u8.rem,
+			bar_u16_u8.quot,
+			bar_u16_u8.rem,
+			(pass_fail ? pass_str : fail_str)
+		);
+		count_test_result(pass_fail, result);
+	}
+
+	for(size_t i = 0; i < (sizeof(vals_u32_u8) / sizeof(vals_u32_u8[0])); i++) {
+		div_u32_u8_ref(vals_u32_u8[i].a, vals_u32_u8[i].b, &foo_u32_u8);
+		div_u32_u8(vals_u32_u8[i].a, vals_u32_u8[i].b, &bar_u32_u8);
+		pass_fail = (foo_u32_u8.quot == bar_u32_u8.quot && foo_u32_u8.rem == bar_u32_u8.rem && ((bar_u32_u8.quot * vals_u32_u8[i].b) + bar_u32_u8.rem) == vals_u32_u8[i].a);
+		printf(
+			"%lu, %u: div_u32_u8_ref = { quot = %lu, rem = %u }, div_u32_u8 = { quot = %lu, rem = %u } - %s\n",
+			vals_u32_u8[i].a,
+			vals_u32_u8[i].b,
+			foo_u32_u8.quot,
+			foo_u32_u8.rem,
+			bar_u32_u8.quot,
+			bar_u32_u8.rem,
+			(pass_fail ? pass_str : fail_str)
+		);
+		count_test_result(pass_fail, result);
+	}
+}
+
+#define test_div_u16_const(x, y) \
+	do { \
+		div_u16_ref((x), (y), &foo_u16); \
+		div_u16_const((x), (y), &bar_u16); \
+		pass_fail = (foo_u16.quot == bar_u16.quot && foo_u16.rem == bar_u16.rem); \
+		printf( \
+			"  %4u: div_u16_ref = { quot = %u, rem = %u }, div_u16_const = { quot = %u, rem = %u } - %s\n", \
+			(y), \
+			foo_u16.quot, \
+			foo_u16.rem, \
+			bar_u16.quot, \
+			bar_u16.rem, \
+			(pass_fail ? pass_str : fail_str) \
+		); \
+		count_test_result(pass_fail, result); \
+	} while(0)
+
+#define test_div_u32_const(x, y) \
+	do { \
+		div_u32_ref((x), (y), &foo_u32); \
+		div_u32_const((x), (y), &bar_u32); \
+		pass_fail = (foo_u32.quot == bar_u32.quot && foo_u32.rem == bar_u32.rem); \
+		printf( \
+			"  %4u: div_u32_ref = { quot = %lu, rem = %lu }, div_u32_const = { quot = %lu, rem = %lu } - %s\n", \
+			(y), \
+			foo_u32.quot, \
+			foo_u32.rem, \
+			bar_u32.quot, \
+			bar_u32.rem, \
+			(pass_fail ? pass_str : fail_str) \
+		); \
+		count_test_result(pass_fail, result); \
+	} while(0)
+
+static void test_div_const(test_result_t *result) {
+	static const uint16_t vals_u16[] = {
+		0, 1, 9, 10, 11, 59, 60, 99, 100, 999, 1000, 1001, 12345, 59999, 65535,
+	};
+	static const uint32_t vals_u32[] = {
+		0UL, 1UL, 9UL, 10UL, 11UL, 59UL, 60UL, 99UL, 100UL, 999UL, 1000UL, 1001UL,
+		3599UL, 3600UL, 3601UL, 123456789UL, 2147483647UL, 4294967295UL,
+	};
+	div_u16_t foo_u16, bar_u16;
+	div_u32_t foo_u32, bar_u32;
+	bool pass_fail;
+
+	for(size_t i = 0; i < (sizeof(vals_u16) / sizeof(vals_u16[0])); i++) {
+		printf("value = %u\n", vals_u16[i]);
+		test_div_u16_const(vals_u16[i], 10);
+		test_div_u16_const(vals_u16[i], 60);
+		test_div_u16_const(vals_u16[i], 100);
+		test_div_u16_const(vals_u16[i], 1000);
+	}
+
+	for(size_t i = 0; i < (sizeof(vals_u32) / sizeof(vals_u32[0])); i++) {
+		printf("value = %lu\n", vals_u32[i]);
+		test_div_u32_const(vals_u32[i], 10);
+		test_div_u32_const(vals_u32[i], 60);
+		test_div_u32_const(vals_u32[i], 100);
+		test_div_u32_const(vals_u32[i], 1000);
+		test_div_u32_const(vals_u32[i], 3600);
+	}
 }
 
 static void benchmark_div(void) {
@@ -570,58 +1336,318 @@ static void benchmark_div(void) {
 	static const int16_t val_s16_b = 45;
 	static const uint16_t val_u16_a = 47832;
 	static const uint16_t val_u16_b = 900;
+	static const int32_t val_s32_a = -1387974L;
+	static const int32_t val_s32_b = 86491L;
 	static const uint32_t val_u32_a = 1387974UL;
 	static const uint32_t val_u32_b = 86491UL;
+	static const uint32_t val_u32_c = 1000UL;
+	static const uint32_t val_u32_d = 60UL;
+	static const uint8_t val_u8_b = 10;
 	div_s16_t result_s16;
 	div_u16_t result_u16;
+	div_s32_t result_s32;
 	div_u32_t result_u32;
+	div_u16_u8_t result_u16_u8;
+	div_u32_u8_t result_u32_u8;
 
 	benchmark("div_s16_ref", div_s16_ref(val_s16_a, val_s16_b, &result_s16));
 	benchmark("div_s16", div_s16(val_s16_a, val_s16_b, &result_s16));
 	benchmark("div_u16_ref", div_u16_ref(val_u16_a, val_u16_b, &result_u16));
 	benchmark("div_u16", div_u16(val_u16_a, val_u16_b, &result_u16));
+	benchmark("div_s32_ref", div_s32_ref(val_s32_a, val_s32_b, &result_s32));
+	benchmark("div_s32", div_s32(val_s32_a, val_s32_b, &result_s32));
 	benchmark("div_u32_ref", div_u32_ref(val_u32_a, val_u32_b, &result_u32));
 	benchmark("div_u32", div_u32(val_u32_a, val_u32_b, &result_u32));
+	benchmark("div_u32_ref (16-bit divisor)", div_u32_ref(val_u32_a, val_u32_c, &result_u32));
+	benchmark("div_u32 (16-bit divisor)", div_u32(val_u32_a, val_u32_c, &result_u32));
+	benchmark("div_u32_ref (8-bit divisor)", div_u32_ref(val_u32_a, val_u32_d, &result_u32));
+	benchmark("div_u32 (8-bit divisor)", div_u32(val_u32_a, val_u32_d, &result_u32));
+	benchmark("div_u16_u8_ref", div_u16_u8_ref(val_u16_a, val_u8_b, &result_u16_u8));
+	benchmark("div_u16_u8", div_u16_u8(val_u16_a, val_u8_b, &result_u16_u8));
+	benchmark("div_u32_u8_ref", div_u32_u8_ref(val_u32_a, val_u8_b, &result_u32_u8));
+	benchmark("div_u32_u8", div_u32_u8(val_u32_a, val_u8_b, &result_u32_u8));
+	benchmark("div_u16 (divisor = 10)", div_u16(val_u16_a, 10, &result_u16));
+	benchmark("div_u16_by_10", div_u16_by_10(val_u16_a, &result_u16));
+	benchmark("div_u16 (divisor = 1000)", div_u16(val_u16_a, 1000, &result_u16));
+	benchmark("div_u16_by_1000", div_u16_by_1000(val_u16_a, &result_u16));
+	benchmark("div_u32 (divisor = 10)", div_u32(val_u32_a, 10, &result_u32));
+	benchmark("div_u32_by_10", div_u32_by_10(val_u32_a, &result_u32));
+	benchmark("div_u32 (divisor = 1000)", div_u32(val_u32_a, 1000, &result_u32));
+	benchmark("div_u32_by_1000", div_u32_by_1000(val_u32_a, &result_u32));
+	benchmark("div_u32 (divisor = 3600)", div_u32(val_u32_a, 3600, &result_u32));
+	benchmark("div_u32_by_3600", div_u32_by_3600(val_u32_a, &result_u32));
 }
 
-static void test_strctcmp(test_result_t *result) {
-	static const struct {
-		const char *a;
-		const char *b;
-		bool eq;
-	} vals[] = {
-		{ "abc", "abc", true },
-		{ "abc", "xyz", false },
-		{ "abc", "abcdef", false },
-		{ "abcdef", "abc", false },
-		{ "", "", true },
-		{ NULL, NULL, false },
-		{ "abc", NULL, false },
-		{ NULL, "abc", false },
+static void benchmark_div_magnitude(void) {
+	static const uint32_t vals_u32_a[] = {
+		50000UL, 100000UL, 1000000UL, 16777215UL, 268435455UL, 4294967295UL,
 	};
-	int cmp;
-	bool pass_fail;
+	static const uint32_t val_u32_b = 86491UL;
+	div_u32_t result_u32;
 
-	for(size_t i = 0; i < (sizeof(vals) / sizeof(vals[0])); i++) {
-		cmp = strctcmp(vals[i].a, vals[i].b);
-		pass_fail = ((cmp == 0) == vals[i].eq);
-		printf(
-			"strctcmp: a = \"%s\", b = \"%s\", ret = %d, equal = %u, expected = %u - %s\n",
-			(vals[i].a != NULL ? vals[i].a : "[NULL]"),
-			(vals[i].b != NULL ? vals[i].b : "[NULL]"),
-			cmp,
-			(cmp == 0),
-			vals[i].eq,
-			(pass_fail ? pass_str : fail_str)
-		);
-		count_test_result(pass_fail, result);
-	}
-}
+	// Time division of dividends of differing magnitude by the same divisor,
+	// so that the effect of magnitude on execution time can be seen.
 
-static void benchmark_strctcmp(void) {
-	static const char *str_a = "abc";
+	for(size_t i = 0; i < (sizeof(vals_u32_a) / sizeof(vals_u32_a[0])); i++) {
+		printf("%s: div_u32_ref (x = %lu)\n", bench_str, vals_u32_a[i]);
+		uint16_t n = 10000;
+		benchmark_marker_start();
+		while(n--) div_u32_ref(vals_u32_a[i], val_u32_b, &result_u32);
+		benchmark_marker_end();
+
+		printf("%s: div_u32 (x = %lu)\n", bench_str, vals_u32_a[i]);
+		n = 10000;
+		benchmark_marker_start();
+		while(n--) div_u32(vals_u32_a[i], val_u32_b, &result_u32);
+		benchmark_marker_end();
+	}
+}
+
+static void test_mul(test_result_t *result) {
+	static const struct {
+		int16_t a;
+		int16_t b;
+	} vals_s16[] = {
+		{ 0, 0 },
+		{ 1, 1 },
+		{ -1, 1 },
+		{ 1, -1 },
+		{ -1, -1 },
+		{ 255, 255 },
+		{ 256, -256 },
+		{ 1000, -30 },
+		{ -12345, 321 },
+		{ 32767, 32767 },
+		{ -32768, 32767 },
+		{ -32768, -32768 },
+	};
+	static const struct {
+		uint16_t a;
+		uint16_t b;
+	} vals_u16[] = {
+		{ 0, 0 },
+		{ 1, 1 },
+		{ 255, 255 },
+		{ 256, 256 },
+		{ 1000, 30 },
+		{ 12345, 321 },
+		{ 32768, 2 },
+		{ 65535, 1 },
+		{ 65535, 65535 },
+	};
+	static const struct {
+		int32_t a;
+		int32_t b;
+	} vals_s32[] = {
+		{ 0L, 0L },
+		{ 1L, 1L },
+		{ -1L, 1L },
+		{ 1L, -1L },
+		{ -1L, -1L },
+		{ 65536L, -65536L },
+		{ 1000000L, -7L },
+		{ -123456789L, 987654L },
+		{ 2147483647L, 2147483647L },
+		{ -2147483647L - 1L, 2147483647L },
+		{ -2147483647L - 1L, -2147483647L - 1L },
+	};
+	static const struct {
+		uint32_t a;
+		uint32_t b;
+	} vals_u32[] = {
+		{ 0UL, 0UL },
+		{ 1UL, 1UL },
+		{ 255UL, 255UL },
+		{ 65535UL, 65535UL },
+		{ 65536UL, 65536UL },
+		{ 1000000UL, 7UL },
+		{ 123456789UL, 987654UL },
+		{ 2147483648UL, 2UL },
+		{ 4294967295UL, 1UL },
+		{ 4294967295UL, 4294967295UL },
+	};
+	int32_t foo_s32, bar_s32;
+	uint32_t foo_u32, bar_u32;
+	mul_s64_t foo_s64, bar_s64;
+	mul_u64_t foo_u64, bar_u64;
+	bool pass_fail;
+
+	for(size_t i = 0; i < (sizeof(vals_s16) / sizeof(vals_s16[0])); i++) {
+		foo_s32 = mul_s16_s32_ref(vals_s16[i].a, vals_s16[i].b);
+		bar_s32 = mul_s16_s32(vals_s16[i].a, vals_s16[i].b);
+		pass_fail = (foo_s32 == bar_s32);
+		printf(
+			"%d, %d: mul_s16_s32_ref = %ld, mul_s16_s32 = %ld - %s\n",
+			vals_s16[i].a,
+			vals_s16[i].b,
+			foo_s32,
+			bar_s32,
+			(pass_fail ? pass_str : fail_str)
+		);
+		count_test_result(pass_fail, result);
+	}
+
+	for(size_t i = 0; i < (sizeof(vals_u16) / sizeof(vals_u16[0])); i++) {
+		foo_u32 = mul_u16_u32_ref(vals_u16[i].a, vals_u16[i].b);
+		bar_u32 = mul_u16_u32(vals_u16[i].a, vals_u16[i].b);
+		pass_fail = (foo_u32 == bar_u32);
+		printf(
+			"%u, %u: mul_u16_u32_ref = %lu, mul_u16_u32 = %lu - %s\n",
+			vals_u16[i].a,
+			vals_u16[i].b,
+			foo_u32,
+			bar_u32,
+			(pass_fail ? pass_str : fail_str)
+		);
+		count_test_result(pass_fail, result);
+	}
+
+	for(size_t i = 0; i < (sizeof(vals_s32) / sizeof(vals_s32[0])); i++) {
+		mul_s32_s64_ref(vals_s32[i].a, vals_s32[i].b, &foo_s64);
+		mul_s32_s64(vals_s32[i].a, vals_s32[i].b, &bar_s64);
+		pass_fail = (foo_s64.hi == bar_s64.hi && foo_s64.lo == bar_s64.lo);
+		printf(
+			"%ld, %ld: mul_s32_s64_ref = 0x%08lX%08lX, mul_s32_s64 = 0x%08lX%08lX - %s\n",
+			vals_s32[i].a,
+			vals_s32[i].b,
+			foo_s64.hi,
+			foo_s64.lo,
+			bar_s64.hi,
+			bar_s64.lo,
+			(pass_fail ? pass_str : fail_str)
+		);
+		count_test_result(pass_fail, result);
+	}
+
+	for(size_t i = 0; i < (sizeof(vals_u32) / sizeof(vals_u32[0])); i++) {
+		mul_u32_u64_ref(vals_u32[i].a, vals_u32[i].b, &foo_u64);
+		mul_u32_u64(vals_u32[i].a, vals_u32[i].b, &bar_u64);
+		pass_fail = (foo_u64.hi == bar_u64.hi && foo_u64.lo == bar_u64.lo);
+		printf(
+			"%lu, %lu: mul_u32_u64_ref = 0x%08lX%08lX, mul_u32_u64 = 0x%08lX%08lX - %s\n",
+			vals_u32[i].a,
+			vals_u32[i].b,
+			foo_u64.hi,
+			foo_u64.lo,
+			bar_u64.hi,
+			bar_u64.lo,
+			(pass_fail ? pass_str : fail_str)
+		);
+		count_test_result(pass_fail, result);
+	}
+}
+
+static void benchmark_mul(void) {
+	static const int16_t val_s16_a = -12345;
+	static const int16_t val_s16_b = 321;
+	static const uint16_t val_u16_a = 47832;
+	static const uint16_t val_u16_b = 900;
+	static const int32_t val_s32_a = -1387974L;
+	static const int32_t val_s32_b = 86491L;
+	static const uint32_t val_u32_a = 1387974UL;
+	static const uint32_t val_u32_b = 86491UL;
+	mul_s64_t result_s64;
+	mul_u64_t result_u64;
+
+	benchmark("mul_s16_s32_ref", mul_s16_s32_ref(val_s16_a, val_s16_b));
+	benchmark("mul_s16_s32", mul_s16_s32(val_s16_a, val_s16_b));
+	benchmark("mul_u16_u32_ref", mul_u16_u32_ref(val_u16_a, val_u16_b));
+	benchmark("mul_u16_u32", mul_u16_u32(val_u16_a, val_u16_b));
+	benchmark("mul_s32_s64_ref", mul_s32_s64_ref(val_s32_a, val_s32_b, &result_s64));
+	benchmark("mul_s32_s64", mul_s32_s64(val_s32_a, val_s32_b, &result_s64));
+	benchmark("mul_u32_u64_ref", mul_u32_u64_ref(val_u32_a, val_u32_b, &result_u64));
+	benchmark("mul_u32_u64", mul_u32_u64(val_u32_a, val_u32_b, &result_u64));
+}
+
+static void test_isqrt(test_result_t *result) {
+	static const uint32_t vals_32[] = {
+		0UL, 1UL, 2UL, 3UL, 4UL, 99UL, 100UL, 101UL, 65535UL, 65536UL, 65537UL,
+		1000000UL, 16777215UL, 16777216UL, 123456789UL, 1073741823UL,
+		1073741824UL, 2147483647UL, 4294836224UL, 4294836225UL, 4294967295UL,
+	};
+	uint16_t fail_count;
+
+	// Test every possible 16-bit value, but only print a summary of the number
+	// of failures, rather than a line for each value.
+
+	fail_count = 0;
+	for(uint32_t i = 0; i <= UINT16_MAX; i++) {
+		if(isqrt_16_ref(i) != isqrt_16(i)) fail_count++;
+	}
+	printf("0x0000-0xFFFF: isqrt_16_ref vs isqrt_16 failures = %u - %s\n", fail_count, (fail_count == 0 ? pass_str : fail_str));
+	count_test_result(fail_count == 0, result);
+#if defined(__reg_args)
+	fail_count = 0;
+	for(uint32_t i = 0; i <= UINT16_MAX; i++) {
+		if(isqrt_16_ref(i) != isqrt_16_ra(i)) fail_count++;
+	}
+	printf("0x0000-0xFFFF: isqrt_16_ref vs isqrt_16_ra failures = %u - %s\n", fail_count, (fail_count == 0 ? pass_str : fail_str));
+	count_test_result(fail_count == 0, result);
+#endif
+
+	for(size_t i = 0; i < (sizeof(vals_32) / sizeof(vals_32[0])); i++) {
+		uint16_t foo = isqrt_32_ref(vals_32[i]);
+		uint16_t bar = isqrt_32(vals_32[i]);
+		printf("%lu: isqrt_32_ref = %u, isqrt_32 = %u - %s\n", vals_32[i], foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+	}
+}
+
+static void benchmark_isqrt(void) {
+	static const uint16_t val_16 = 54321;
+	static const uint32_t val_32 = 3000000000UL;
+
+	benchmark("isqrt_16_ref", isqrt_16_ref(val_16));
+	benchmark("isqrt_16", isqrt_16(val_16));
+#if defined(__reg_args)
+	benchmark("isqrt_16_ra", isqrt_16_ra(val_16));
+#endif
+
+	benchmark("isqrt_32_ref", isqrt_32_ref(val_32));
+	benchmark("isqrt_32", isqrt_32(val_32));
+}
+
+static void test_strctcmp(test_result_t *result) {
+	static const struct {
+		const char *a;
+		const char *b;
+		bool eq;
+	} vals[] = {
+		{ "abc", "abc", true },
+		{ "abc", "xyz", false },
+		{ "abc", "abcdef", false },
+		{ "abcdef", "abc", false },
+		{ "", "", true },
+		{ NULL, NULL, false },
+		{ "abc", NULL, false },
+		{ NULL, "abc", false },
+	};
+	int cmp;
+	bool pass_fail;
+
+	for(size_t i = 0; i < (sizeof(vals) / sizeof(vals[0])); i++) {
+		cmp = strctcmp(vals[i].a, vals[i].b);
+		pass_fail = ((cmp == 0) == vals[i].eq);
+		printf(
+			"strctcmp: a = \"%s\", b = \"%s\", ret = %d, equal = %u, expected = %u - %s\n",
+			(vals[i].a != NULL ? vals[i].a : "[NULL]"),
+			(vals[i].b != NULL ? vals[i].b : "[NULL]"),
+			cmp,
+			(cmp == 0),
+			vals[i].eq,
+			(pass_fail ? pass_str : fail_str)
+		);
+		count_test_result(pass_fail, result);
+	}
+}
+
+static void benchmark_strctcmp(void) {
+	static const char *str_a = "abc";
 	static const char *str_b = "xyz";
 	static const char *str_c = "abcdef";
+	static const char str_len_a[] = "abcdefgh";
+	static const char str_len_b[] = "abcdefgh";
+	static const char str_len_c[] = "ABCDEFGH";
 
 	// These aren't really benchmarks in terms of comparing speed of execution
 	// between two different implementations, but rather a means of checking
@@ -657,6 +1683,811 @@ static void benchmark_strctcmp(void) {
 	benchmark_marker_start();
 	strctcmp(str_c, str_b);
 	benchmark_marker_end();
+
+	// Time a single call for every length of first string from 0 to 8, each
+	// against an equal string, a string of the same length differing in every
+	// character, and an empty string. All three should take the same number
+	// of cycles for a given length. Strings of each length are taken from the
+	// tail of the full-length strings.
+
+	for(uint8_t i = 0; i <= 8; i++) {
+		printf("%s: strctcmp (len = %u, equal)\n", bench_str, i);
+		benchmark_marker_start();
+		strctcmp(str_len_a + (8 - i), str_len_b + (8 - i));
+		benchmark_marker_end();
+
+		printf("%s: strctcmp (len = %u, non-equal)\n", bench_str, i);
+		benchmark_marker_start();
+		strctcmp(str_len_a + (8 - i), str_len_c + (8 - i));
+		benchmark_marker_end();
+
+		printf("%s: strctcmp (len = %u, empty)\n", bench_str, i);
+		benchmark_marker_start();
+		strctcmp(str_len_a + (8 - i), str_len_a + 8);
+		benchmark_marker_end();
+	}
+}
+
+static void test_memctcmp(test_result_t *result) {
+	// Binary data, including zero bytes, which must not end the comparison.
+	static const uint8_t buf_a[] = {
+		0x00, 0x11, 0x22, 0x00, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0x00, 0xBB,
+	};
+	static const uint8_t buf_b[] = {
+		0x00, 0x11, 0x22, 0x00, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0x00, 0xBB,
+	};
+	static const uint8_t buf_c[] = {
+		0x00, 0x11, 0x22, 0x00, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0x00, 0xBA,
+	};
+	static const uint8_t buf_d[] = {
+		0x01, 0x11, 0x22, 0x00, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0x00, 0xBB,
+	};
+	static const struct {
+		const uint8_t *a;
+		const uint8_t *b;
+		size_t n;
+		bool eq;
+	} vals[] = {
+		{ buf_a, buf_b, sizeof(buf_a), true },
+		{ buf_a, buf_c, sizeof(buf_a), false },
+		{ buf_a, buf_c, sizeof(buf_a) - 1, true },
+		{ buf_a, buf_d, sizeof(buf_a), false },
+		{ buf_a, buf_d, 1, false },
+		{ buf_a, buf_d, 0, true },
+		{ buf_c, buf_d, 3, false },
+		{ buf_b, buf_c, 5, true },
+	};
+	int cmp;
+	bool pass_fail;
+
+	for(size_t i = 0; i < (sizeof(vals) / sizeof(vals[0])); i++) {
+		cmp = memctcmp(vals[i].a, vals[i].b, vals[i].n);
+		pass_fail = ((cmp == 0) == vals[i].eq);
+		printf(
+			"memctcmp: test %u, n = %u, ret = %d, equal = %u, expected = %u - %s\n",
+			i,
+			vals[i].n,
+			cmp,
+			(cmp == 0),
+			vals[i].eq,
+			(pass_fail ? pass_str : fail_str)
+		);
+		count_test_result(pass_fail, result);
+	}
+}
+
+static void benchmark_memctcmp(void) {
+	static const uint8_t buf_a[16] = {
+		0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+		0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF,
+	};
+	static const uint8_t buf_b[16] = { 0 };
+	static const uint8_t buf_c[16] = {
+		0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+		0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFE,
+	};
+
+	// As for strctcmp, these are a means of checking that comparison of equal
+	// and non-equal buffers of the same length take the same number of
+	// execution cycles, whether they differ in the first byte (A-B), only in
+	// the last byte (A-C), or not at all (A-A). Odd lengths are also checked,
+	// as the remainder bytes are handled separately.
+
+	benchmark_print_header("memctcmp (A-A, 16)");
+	benchmark_marker_start();
+	memctcmp(buf_a, buf_a, 16);
+	benchmark_marker_end();
+
+	benchmark_print_header("memctcmp (A-B, 16)");
+	benchmark_marker_start();
+	memctcmp(buf_a, buf_b, 16);
+	benchmark_marker_end();
+
+	benchmark_print_header("memctcmp (A-C, 16)");
+	benchmark_marker_start();
+	memctcmp(buf_a, buf_c, 16);
+	benchmark_marker_end();
+
+	benchmark_print_header("memctcmp (A-A, 15)");
+	benchmark_marker_start();
+	memctcmp(buf_a, buf_a, 15);
+	benchmark_marker_end();
+
+	benchmark_print_header("memctcmp (A-B, 15)");
+	benchmark_marker_start();
+	memctcmp(buf_a, buf_b, 15);
+	benchmark_marker_end();
+
+	benchmark_print_header("memctcmp (A-C, 15)");
+	benchmark_marker_start();
+	memctcmp(buf_a + 1, buf_c + 1, 15);
+	benchmark_marker_end();
+}
+
+static void test_crc(test_result_t *result) {
+	static const uint8_t check_str[] = "123456789";
+	static uint8_t buf[64];
+	static const uint16_t lens[] = { 0, 1, 2, 7, 33, sizeof(buf) };
+	static const uint16_t splits[] = { 1, 7, 32 };
+
+	for(size_t i = 0; i < sizeof(buf); i++) buf[i] = (uint8_t)((i * 37) + 11);
+
+	// Check the standard check values for each algorithm, i.e. the CRC of the
+	// ASCII string "123456789" with the algorithm's initial and final XOR
+	// values applied.
+	{
+		uint8_t foo = crc_8_update_ref(0x00, check_str, 9);
+		uint8_t bar = crc_8_update(0x00, check_str, 9);
+		printf("\"%s\": crc_8_update_ref = 0x%02X, crc_8_update = 0x%02X, expected = 0x%02X - %s\n", check_str, foo, bar, 0xF4, (foo == 0xF4 && bar == 0xF4 ? pass_str : fail_str));
+		count_test_result(foo == 0xF4 && bar == 0xF4, result);
+	}
+	{
+		uint16_t foo = crc_16_ccitt_update_ref(0xFFFF, check_str, 9);
+		uint16_t bar = crc_16_ccitt_update(0xFFFF, check_str, 9);
+		printf("\"%s\": crc_16_ccitt_update_ref = 0x%04X, crc_16_ccitt_update = 0x%04X, expected = 0x%04X - %s\n", check_str, foo, bar, 0x29B1, (foo == 0x29B1 && bar == 0x29B1 ? pass_str : fail_str));
+		count_test_result(foo == 0x29B1 && bar == 0x29B1, result);
+	}
+	{
+		uint16_t foo = crc_16_ccitt_update_ref(0x0000, check_str, 9);
+		uint16_t bar = crc_16_ccitt_update(0x0000, check_str, 9);
+		printf("\"%s\": crc_16_ccitt_update_ref = 0x%04X, crc_16_ccitt_update = 0x%04X, expected = 0x%04X - %s\n", check_str, foo, bar, 0x31C3, (foo == 0x31C3 && bar == 0x31C3 ? pass_str : fail_str));
+		count_test_result(foo == 0x31C3 && bar == 0x31C3, result);
+	}
+	{
+		uint16_t foo = crc_16_modbus_update_ref(0xFFFF, check_str, 9);
+		uint16_t bar = crc_16_modbus_update(0xFFFF, check_str, 9);
+		printf("\"%s\": crc_16_modbus_update_ref = 0x%04X, crc_16_modbus_update = 0x%04X, expected = 0x%04X - %s\n", check_str, foo, bar, 0x4B37, (foo == 0x4B37 && bar == 0x4B37 ? pass_str : fail_str));
+		count_test_result(foo == 0x4B37 && bar == 0x4B37, result);
+	}
+	{
+		uint32_t foo = crc_32_update_ref(0xFFFFFFFF, check_str, 9) ^ 0xFFFFFFFF;
+		uint32_t bar = crc_32_update(0xFFFFFFFF, check_str, 9) ^ 0xFFFFFFFF;
+		printf("\"%s\": crc_32_update_ref = 0x%08lX, crc_32_update = 0x%08lX, expected = 0x%08lX - %s\n", check_str, foo, bar, 0xCBF43926, (foo == 0xCBF43926 && bar == 0xCBF43926 ? pass_str : fail_str));
+		count_test_result(foo == 0xCBF43926 && bar == 0xCBF43926, result);
+	}
+
+	// Compare against the reference implementations over various lengths of
+	// arbitrary data, with a non-trivial initial CRC value.
+	for(size_t i = 0; i < (sizeof(lens) / sizeof(lens[0])); i++) {
+		uint8_t foo = crc_8_update_ref(0x5A, buf, lens[i]);
+		uint8_t bar = crc_8_update(0x5A, buf, lens[i]);
+		printf("len = %u: crc_8_update_ref = 0x%02X, crc_8_update = 0x%02X - %s\n", lens[i], foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+	}
+
+	for(size_t i = 0; i < (sizeof(lens) / sizeof(lens[0])); i++) {
+		uint16_t foo = crc_16_ccitt_update_ref(0x1D0F, buf, lens[i]);
+		uint16_t bar = crc_16_ccitt_update(0x1D0F, buf, lens[i]);
+		printf("len = %u: crc_16_ccitt_update_ref = 0x%04X, crc_16_ccitt_update = 0x%04X - %s\n", lens[i], foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+	}
+
+	for(size_t i = 0; i < (sizeof(lens) / sizeof(lens[0])); i++) {
+		uint16_t foo = crc_16_modbus_update_ref(0x1D0F, buf, lens[i]);
+		uint16_t bar = crc_16_modbus_update(0x1D0F, buf, lens[i]);
+		printf("len = %u: crc_16_modbus_update_ref = 0x%04X, crc_16_modbus_update = 0x%04X - %s\n", lens[i], foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+	}
+
+	for(size_t i = 0; i < (sizeof(lens) / sizeof(lens[0])); i++) {
+		uint32_t foo = crc_32_update_ref(0x12345678, buf, lens[i]);
+		uint32_t bar = crc_32_update(0x12345678, buf, lens[i]);
+		printf("len = %u: crc_32_update_ref = 0x%08lX, crc_32_update = 0x%08lX - %s\n", lens[i], foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+	}
+
+	// Check that calculating the CRC incrementally, by feeding the result of
+	// one update into the next, gives the same result as doing it in one go.
+	for(size_t i = 0; i < (sizeof(splits) / sizeof(splits[0])); i++) {
+		uint32_t foo = crc_32_update(0xFFFFFFFF, buf, sizeof(buf));
+		uint32_t bar = crc_32_update(crc_32_update(0xFFFFFFFF, buf, splits[i]), buf + splits[i], sizeof(buf) - splits[i]);
+		printf("split = %u: crc_32_update whole = 0x%08lX, crc_32_update parts = 0x%08lX - %s\n", splits[i], foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+	}
+}
+
+static void benchmark_crc(void) {
+	static uint8_t buf[64];
+
+	for(size_t i = 0; i < sizeof(buf); i++) buf[i] = (uint8_t)((i * 37) + 11);
+
+	// Each iteration covers a whole 64-byte buffer, so 1,000 iterations is
+	// 64,000 bytes; throughput in bytes per second is therefore 64,000
+	// divided by the measured time in seconds.
+
+	benchmark_print_header("crc_8_update_ref");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) crc_8_update_ref(0x00, buf, sizeof(buf));
+	benchmark_marker_end();
+
+	benchmark_print_header("crc_8_update");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) crc_8_update(0x00, buf, sizeof(buf));
+	benchmark_marker_end();
+
+	benchmark_print_header("crc_16_ccitt_update_ref");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) crc_16_ccitt_update_ref(0xFFFF, buf, sizeof(buf));
+	benchmark_marker_end();
+
+	benchmark_print_header("crc_16_ccitt_update");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) crc_16_ccitt_update(0xFFFF, buf, sizeof(buf));
+	benchmark_marker_end();
+
+	benchmark_print_header("crc_16_modbus_update_ref");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) crc_16_modbus_update_ref(0xFFFF, buf, sizeof(buf));
+	benchmark_marker_end();
+
+	benchmark_print_header("crc_16_modbus_update");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) crc_16_modbus_update(0xFFFF, buf, sizeof(buf));
+	benchmark_marker_end();
+
+	benchmark_print_header("crc_32_update_ref");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) crc_32_update_ref(0xFFFFFFFF, buf, sizeof(buf));
+	benchmark_marker_end();
+
+	benchmark_print_header("crc_32_update");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) crc_32_update(0xFFFFFFFF, buf, sizeof(buf));
+	benchmark_marker_end();
+}
+
+static void test_checksum(test_result_t *result) {
+	static const uint8_t check_str[] = "123456789";
+	// Example data from RFC 1071, section 3.
+	static const uint8_t inet_data[] = { 0x00, 0x01, 0xF2, 0x03, 0xF4, 0xF5, 0xF6, 0xF7 };
+	static uint8_t buf[300];
+	static const uint16_t lens[] = { 0, 1, 2, 7, 33, 64, sizeof(buf) };
+
+	for(size_t i = 0; i < sizeof(buf); i++) buf[i] = (uint8_t)((i * 37) + 11);
+
+	// Check the known check values for each algorithm.
+	{
+		uint16_t foo = fletcher_16_update_ref(0x0000, check_str, 9);
+		uint16_t bar = fletcher_16_update(0x0000, check_str, 9);
+		printf("\"%s\": fletcher_16_update_ref = 0x%04X, fletcher_16_update = 0x%04X, expected = 0x%04X - %s\n", check_str, foo, bar, 0x1EDE, (foo == 0x1EDE && bar == 0x1EDE ? pass_str : fail_str));
+		count_test_result(foo == 0x1EDE && bar == 0x1EDE, result);
+	}
+	{
+		uint32_t foo = adler_32_update_ref(1, check_str, 9);
+		uint32_t bar = adler_32_update(1, check_str, 9);
+		printf("\"%s\": adler_32_update_ref = 0x%08lX, adler_32_update = 0x%08lX, expected = 0x%08lX - %s\n", check_str, foo, bar, 0x091E01DE, (foo == 0x091E01DE && bar == 0x091E01DE ? pass_str : fail_str));
+		count_test_result(foo == 0x091E01DE && bar == 0x091E01DE, result);
+	}
+	{
+		uint16_t foo = ones_sum_16_update_ref(0x0000, inet_data, sizeof(inet_data));
+		uint16_t bar = ones_sum_16_update(0x0000, inet_data, sizeof(inet_data));
+		printf("RFC 1071: ones_sum_16_update_ref = 0x%04X, ones_sum_16_update = 0x%04X, expected = 0x%04X - %s\n", foo, bar, 0xDDF2, (foo == 0xDDF2 && bar == 0xDDF2 ? pass_str : fail_str));
+		count_test_result(foo == 0xDDF2 && bar == 0xDDF2, result);
+	}
+
+	// Compare against the reference implementations over various lengths of
+	// arbitrary data, with a non-trivial initial value.
+	for(size_t i = 0; i < (sizeof(lens) / sizeof(lens[0])); i++) {
+		uint16_t foo = fletcher_16_update_ref(0x1234, buf, lens[i]);
+		uint16_t bar = fletcher_16_update(0x1234, buf, lens[i]);
+		printf("len = %u: fletcher_16_update_ref = 0x%04X, fletcher_16_update = 0x%04X - %s\n", lens[i], foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+	}
+
+	for(size_t i = 0; i < (sizeof(lens) / sizeof(lens[0])); i++) {
+		uint32_t foo = adler_32_update_ref(0xFFF0FFF0, buf, lens[i]);
+		uint32_t bar = adler_32_update(0xFFF0FFF0, buf, lens[i]);
+		printf("len = %u: adler_32_update_ref = 0x%08lX, adler_32_update = 0x%08lX - %s\n", lens[i], foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+	}
+
+	for(size_t i = 0; i < (sizeof(lens) / sizeof(lens[0])); i++) {
+		uint16_t foo = ones_sum_16_update_ref(0xFEDC, buf, lens[i]);
+		uint16_t bar = ones_sum_16_update(0xFEDC, buf, lens[i]);
+		printf("len = %u: ones_sum_16_update_ref = 0x%04X, ones_sum_16_update = 0x%04X - %s\n", lens[i], foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+	}
+}
+
+static void benchmark_checksum(void) {
+	static uint8_t buf[64];
+
+	for(size_t i = 0; i < sizeof(buf); i++) buf[i] = (uint8_t)((i * 37) + 11);
+
+	// As for the CRC functions, each iteration covers a whole 64-byte buffer,
+	// so throughput in bytes per second is 64,000 divided by the measured
+	// time in seconds.
+
+	benchmark_print_header("fletcher_16_update_ref");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) fletcher_16_update_ref(0x0000, buf, sizeof(buf));
+	benchmark_marker_end();
+
+	benchmark_print_header("fletcher_16_update");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) fletcher_16_update(0x0000, buf, sizeof(buf));
+	benchmark_marker_end();
+
+	benchmark_print_header("adler_32_update_ref");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) adler_32_update_ref(1, buf, sizeof(buf));
+	benchmark_marker_end();
+
+	benchmark_print_header("adler_32_update");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) adler_32_update(1, buf, sizeof(buf));
+	benchmark_marker_end();
+
+	benchmark_print_header("ones_sum_16_update_ref");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) ones_sum_16_update_ref(0x0000, buf, sizeof(buf));
+	benchmark_marker_end();
+
+	benchmark_print_header("ones_sum_16_update");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) ones_sum_16_update(0x0000, buf, sizeof(buf));
+	benchmark_marker_end();
+}
+
+static void test_utoa(test_result_t *result) {
+	static const uint32_t vals_u32[] = {
+		0UL, 1UL, 9UL, 10UL, 99UL, 100UL, 65535UL, 65536UL, 99999UL, 100000UL,
+		999999999UL, 1000000000UL, 2147483647UL, 2147483648UL, 4294967295UL,
+	};
+	static const int32_t vals_s32[] = {
+		0L, 1L, -1L, 10L, -10L, 65536L, -65536L, 2147483647L, -2147483647L, INT32_MIN,
+	};
+	char str_a[12], str_b[12];
+	uint8_t len_a, len_b;
+	uint16_t fail_count;
+	uint16_t i;
+
+	// Exhaustively test all 16-bit values, only printing a line for the first
+	// failure (if any) and a summary at the end.
+	fail_count = 0;
+	i = 0;
+	do {
+		len_a = utoa_16_ref(i, str_a);
+		len_b = utoa_16(i, str_b);
+		if(len_a != len_b || strcmp(str_a, str_b) != 0) {
+			if(fail_count++ == 0) printf("%u: utoa_16_ref = \"%s\" (%u), utoa_16 = \"%s\" (%u) - %s\n", i, str_a, len_a, str_b, len_b, fail_str);
+		}
+	} while(++i);
+	printf("utoa_16: all values, failures = %u - %s\n", fail_count, (fail_count == 0 ? pass_str : fail_str));
+	count_test_result(fail_count == 0, result);
+
+	fail_count = 0;
+	i = 0;
+	do {
+		len_a = itoa_16_ref((int16_t)i, str_a);
+		len_b = itoa_16((int16_t)i, str_b);
+		if(len_a != len_b || strcmp(str_a, str_b) != 0) {
+			if(fail_count++ == 0) printf("%d: itoa_16_ref = \"%s\" (%u), itoa_16 = \"%s\" (%u) - %s\n", (int16_t)i, str_a, len_a, str_b, len_b, fail_str);
+		}
+	} while(++i);
+	printf("itoa_16: all values, failures = %u - %s\n", fail_count, (fail_count == 0 ? pass_str : fail_str));
+	count_test_result(fail_count == 0, result);
+
+	for(size_t j = 0; j < (sizeof(vals_u32) / sizeof(vals_u32[0])); j++) {
+		len_a = utoa_32_ref(vals_u32[j], str_a);
+		len_b = utoa_32(vals_u32[j], str_b);
+		printf("%lu: utoa_32_ref = \"%s\" (%u), utoa_32 = \"%s\" (%u) - %s\n", vals_u32[j], str_a, len_a, str_b, len_b, (len_a == len_b && strcmp(str_a, str_b) == 0 ? pass_str : fail_str));
+		count_test_result(len_a == len_b && strcmp(str_a, str_b) == 0, result);
+	}
+
+	for(size_t j = 0; j < (sizeof(vals_s32) / sizeof(vals_s32[0])); j++) {
+		len_a = itoa_32_ref(vals_s32[j], str_a);
+		len_b = itoa_32(vals_s32[j], str_b);
+		printf("%ld: itoa_32_ref = \"%s\" (%u), itoa_32 = \"%s\" (%u) - %s\n", vals_s32[j], str_a, len_a, str_b, len_b, (len_a == len_b && strcmp(str_a, str_b) == 0 ? pass_str : fail_str));
+		count_test_result(len_a == len_b && strcmp(str_a, str_b) == 0, result);
+	}
+}
+
+static void benchmark_utoa(void) {
+	char str[12];
+
+	// Compare against formatting with sprintf, as would otherwise be used.
+	// Values with the maximum number of digits are used, as execution time
+	// increases with the number of digits.
+
+	benchmark("sprintf (%%u)", sprintf(str, "%u", 65535U));
+	benchmark("utoa_16_ref", utoa_16_ref(65535U, str));
+	benchmark("utoa_16", utoa_16(65535U, str));
+	benchmark("sprintf (%%d)", sprintf(str, "%d", -32768));
+	benchmark("itoa_16", itoa_16(-32768, str));
+	benchmark("sprintf (%%lu)", sprintf(str, "%lu", 4294967295UL));
+	benchmark("utoa_32_ref", utoa_32_ref(4294967295UL, str));
+	benchmark("utoa_32", utoa_32(4294967295UL, str));
+	benchmark("sprintf (%%ld)", sprintf(str, "%ld", -2147483647L));
+	benchmark("itoa_32", itoa_32(-2147483647L, str));
+}
+
+static void test_bcd(test_result_t *result) {
+	static const uint32_t vals_32[] = {
+		0UL, 1UL, 9UL, 10UL, 99UL, 100UL, 65535UL, 65536UL, 99999999UL,
+		100000000UL, 1234567890UL, 2147483648UL, 4294967295UL,
+	};
+	uint8_t bcd_a[5], bcd_b[5];
+	uint16_t fail_count;
+	uint16_t i;
+
+	// Exhaustively test all 16-bit values, only printing a line for the first
+	// failure (if any) and a summary at the end.
+	fail_count = 0;
+	i = 0;
+	do {
+		uint32_t foo = bin2bcd_16_ref(i);
+		uint32_t bar = bin2bcd_16(i);
+		if(foo != bar) {
+			if(fail_count++ == 0) printf("%u: bin2bcd_16_ref = 0x%05lX, bin2bcd_16 = 0x%05lX - %s\n", i, foo, bar, fail_str);
+		}
+	} while(++i);
+	printf("bin2bcd_16: all values, failures = %u - %s\n", fail_count, (fail_count == 0 ? pass_str : fail_str));
+	count_test_result(fail_count == 0, result);
+
+	fail_count = 0;
+	i = 0;
+	do {
+		uint32_t bcd = bin2bcd_16_ref(i);
+		uint16_t foo = bcd2bin_16_ref(bcd);
+		uint16_t bar = bcd2bin_16(bcd);
+		if(foo != bar || bar != i) {
+			if(fail_count++ == 0) printf("0x%05lX: bcd2bin_16_ref = %u, bcd2bin_16 = %u - %s\n", bcd, foo, bar, fail_str);
+		}
+	} while(++i);
+	printf("bcd2bin_16: all values, failures = %u - %s\n", fail_count, (fail_count == 0 ? pass_str : fail_str));
+	count_test_result(fail_count == 0, result);
+
+	for(size_t j = 0; j < (sizeof(vals_32) / sizeof(vals_32[0])); j++) {
+		bin2bcd_32_ref(vals_32[j], bcd_a);
+		bin2bcd_32(vals_32[j], bcd_b);
+		printf(
+			"%lu: bin2bcd_32_ref = 0x%02X%02X%02X%02X%02X, bin2bcd_32 = 0x%02X%02X%02X%02X%02X - %s\n",
+			vals_32[j],
+			bcd_a[0], bcd_a[1], bcd_a[2], bcd_a[3], bcd_a[4],
+			bcd_b[0], bcd_b[1], bcd_b[2], bcd_b[3], bcd_b[4],
+			(memcmp(bcd_a, bcd_b, sizeof(bcd_a)) == 0 ? pass_str : fail_str)
+		);
+		count_test_result(memcmp(bcd_a, bcd_b, sizeof(bcd_a)) == 0, result);
+	}
+
+	for(size_t j = 0; j < (sizeof(vals_32) / sizeof(vals_32[0])); j++) {
+		bin2bcd_32_ref(vals_32[j], bcd_a);
+		uint32_t foo = bcd2bin_32_ref(bcd_a);
+		uint32_t bar = bcd2bin_32(bcd_a);
+		printf("0x%02X%02X%02X%02X%02X: bcd2bin_32_ref = %lu, bcd2bin_32 = %lu - %s\n", bcd_a[0], bcd_a[1], bcd_a[2], bcd_a[3], bcd_a[4], foo, bar, (foo == bar && bar == vals_32[j] ? pass_str : fail_str));
+		count_test_result(foo == bar && bar == vals_32[j], result);
+	}
+}
+
+static void benchmark_bcd(void) {
+	static const uint8_t bcd_32[5] = { 0x42, 0x94, 0x96, 0x72, 0x95 };
+	uint8_t bcd[5];
+
+	// Values with the maximum number of digits are used. The reference
+	// implementations use plain C division and modulo by 10.
+
+	benchmark("bin2bcd_16_ref", bin2bcd_16_ref(65535U));
+	benchmark("bin2bcd_16", bin2bcd_16(65535U));
+	benchmark("bin2bcd_32_ref", bin2bcd_32_ref(4294967295UL, bcd));
+	benchmark("bin2bcd_32", bin2bcd_32(4294967295UL, bcd));
+	benchmark("bcd2bin_16_ref", bcd2bin_16_ref(0x65535UL));
+	benchmark("bcd2bin_16", bcd2bin_16(0x65535UL));
+	benchmark("bcd2bin_32_ref", bcd2bin_32_ref(bcd_32));
+	benchmark("bcd2bin_32", bcd2bin_32(bcd_32));
+}
+
+static void test_hex(test_result_t *result) {
+	static const uint8_t buf[] = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0x00, 0xFF };
+	static const struct {
+		const char *str;
+		bool valid;
+	} strs[] = {
+		{ "0123456789abcdefABCDEF00", true },
+		{ "DeadBeef", true },
+		{ "12345G", false },
+		{ "12 34", false },
+		{ "1234/", false },
+		{ "1234:", false },
+		{ "1234@", false },
+		{ "1234`", false },
+		{ "123", false },
+	};
+	char str_a[24], str_b[24];
+	uint8_t dec_a[12], dec_b[12];
+
+	for(uint8_t lower = 0; lower < 2; lower++) {
+		for(uint16_t len = 0; len <= sizeof(buf); len += 5) {
+			hex_encode_buf_ref(str_a, buf, len, lower);
+			hex_encode_buf(str_b, buf, len, lower);
+			printf("len = %u: hex_encode_buf_ref = \"%s\", hex_encode_buf = \"%s\" - %s\n", len, str_a, str_b, (strcmp(str_a, str_b) == 0 ? pass_str : fail_str));
+			count_test_result(strcmp(str_a, str_b) == 0, result);
+		}
+
+		hex_encode_8(0xA5, str_b, lower);
+		printf("0xA5: hex_encode_8 = \"%s\" - %s\n", str_b, (strcmp(str_b, (lower ? "a5" : "A5")) == 0 ? pass_str : fail_str));
+		count_test_result(strcmp(str_b, (lower ? "a5" : "A5")) == 0, result);
+
+		hex_encode_16(0x0F1E, str_b, lower);
+		printf("0x0F1E: hex_encode_16 = \"%s\" - %s\n", str_b, (strcmp(str_b, (lower ? "0f1e" : "0F1E")) == 0 ? pass_str : fail_str));
+		count_test_result(strcmp(str_b, (lower ? "0f1e" : "0F1E")) == 0, result);
+
+		hex_encode_32(0xDEADBEEF, str_b, lower);
+		printf("0xDEADBEEF: hex_encode_32 = \"%s\" - %s\n", str_b, (strcmp(str_b, (lower ? "deadbeef" : "DEADBEEF")) == 0 ? pass_str : fail_str));
+		count_test_result(strcmp(str_b, (lower ? "deadbeef" : "DEADBEEF")) == 0, result);
+	}
+
+	// Decode each string as a whole number of bytes, including the bytes
+	// made by any odd trailing character paired with the null terminator.
+	for(size_t i = 0; i < (sizeof(strs) / sizeof(strs[0])); i++) {
+		uint16_t len = (strlen(strs[i].str) + 1) / 2;
+		bool foo = hex_decode_buf_ref(dec_a, strs[i].str, len);
+		bool bar = hex_decode_buf(dec_b, strs[i].str, len);
+		bool pass_fail = (foo == strs[i].valid && bar == strs[i].valid && (!bar || memcmp(dec_a, dec_b, len) == 0));
+		printf("\"%s\": hex_decode_buf_ref = %u, hex_decode_buf = %u - %s\n", strs[i].str, foo, bar, (pass_fail ? pass_str : fail_str));
+		count_test_result(pass_fail, result);
+	}
+
+	{
+		uint8_t val_8 = 0;
+		uint16_t val_16 = 0;
+		uint32_t val_32 = 0;
+		bool pass_fail;
+
+		pass_fail = (hex_decode_8("c3", &val_8) && val_8 == 0xC3);
+		printf("\"c3\": hex_decode_8 = 0x%02X - %s\n", val_8, (pass_fail ? pass_str : fail_str));
+		count_test_result(pass_fail, result);
+
+		pass_fail = (hex_decode_16("0F1e", &val_16) && val_16 == 0x0F1E);
+		printf("\"0F1e\": hex_decode_16 = 0x%04X - %s\n", val_16, (pass_fail ? pass_str : fail_str));
+		count_test_result(pass_fail, result);
+
+		pass_fail = (hex_decode_32("DeadBeef", &val_32) && val_32 == 0xDEADBEEF);
+		printf("\"DeadBeef\": hex_decode_32 = 0x%08lX - %s\n", val_32, (pass_fail ? pass_str : fail_str));
+		count_test_result(pass_fail, result);
+
+		// Value must be left unchanged when the string is invalid.
+		pass_fail = (!hex_decode_32("DeadBeex", &val_32) && val_32 == 0xDEADBEEF);
+		printf("\"DeadBeex\": hex_decode_32 = 0x%08lX - %s\n", val_32, (pass_fail ? pass_str : fail_str));
+		count_test_result(pass_fail, result);
+	}
+}
+
+static void benchmark_hex(void) {
+	static uint8_t buf[64];
+	static char str[(sizeof(buf) * 2) + 1];
+	uint32_t val_32;
+
+	for(size_t i = 0; i < sizeof(buf); i++) buf[i] = (uint8_t)((i * 37) + 11);
+
+	benchmark("sprintf (%%08lX)", sprintf(str, "%08lX", 0xDEADBEEF));
+	benchmark("hex_encode_32", hex_encode_32(0xDEADBEEF, str, false));
+	benchmark("strtoul (16)", strtoul("DEADBEEF", NULL, 16));
+	benchmark("hex_decode_32", hex_decode_32("DEADBEEF", &val_32));
+
+	// Only 1,000 iterations, as each covers a whole 64-byte buffer.
+
+	benchmark_print_header("hex_encode_buf_ref");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) hex_encode_buf_ref(str, buf, sizeof(buf), false);
+	benchmark_marker_end();
+
+	benchmark_print_header("hex_encode_buf");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) hex_encode_buf(str, buf, sizeof(buf), false);
+	benchmark_marker_end();
+
+	benchmark_print_header("hex_decode_buf_ref");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) hex_decode_buf_ref(buf, str, sizeof(buf));
+	benchmark_marker_end();
+
+	benchmark_print_header("hex_decode_buf");
+	benchmark_marker_start();
+	for(uint16_t n = 1000; n; n--) hex_decode_buf(buf, str, sizeof(buf));
+	benchmark_marker_end();
+}
+
+static void test_strtou(test_result_t *result) {
+	static const char * const strs[] = {
+		"", "x", "0", "00065535", "65535 ", "65536", "12a34", "/1", ":1",
+		"4294967295", "4294967296", "42949672950", "0004294967295,",
+		"99999999999999999999",
+	};
+	char str[12];
+	uint8_t len, len_a, len_b;
+	uint16_t val_16_a, val_16_b;
+	uint32_t val_32_a, val_32_b;
+	uint16_t fail_count;
+	uint16_t i;
+
+	// Exhaustively test that every 16-bit value formatted by utoa_16 parses
+	// back to the same value, consuming the whole string. Only print a line
+	// for the first failure (if any) and a summary at the end.
+	fail_count = 0;
+	i = 0;
+	do {
+		len = utoa_16(i, str);
+		val_16_b = ~i;
+		len_b = strtou16(str, &val_16_b);
+		if(len_b != len || val_16_b != i) {
+			if(fail_count++ == 0) printf("\"%s\": strtou16 = %u (%u) - %s\n", str, val_16_b, len_b, fail_str);
+		}
+	} while(++i);
+	printf("strtou16: all values, failures = %u - %s\n", fail_count, (fail_count == 0 ? pass_str : fail_str));
+	count_test_result(fail_count == 0, result);
+
+	// Likewise for 32-bit values, with the upper half taking every value and
+	// the lower half a scrambled function of it, to cover all lengths.
+	fail_count = 0;
+	i = 0;
+	do {
+		uint32_t val = ((uint32_t)i << 16) | (uint16_t)(i * 40503U);
+		len = utoa_32(val, str);
+		val_32_b = ~val;
+		len_b = strtou32(str, &val_32_b);
+		if(len_b != len || val_32_b != val) {
+			if(fail_count++ == 0) printf("\"%s\": strtou32 = %lu (%u) - %s\n", str, val_32_b, len_b, fail_str);
+		}
+	} while(++i);
+	printf("strtou32: all upper 16-bit values, failures = %u - %s\n", fail_count, (fail_count == 0 ? pass_str : fail_str));
+	count_test_result(fail_count == 0, result);
+
+	// Check strings with leading zeroes, trailing characters, no digits and
+	// overflowing values against the reference. When zero is returned, the
+	// value must be left unchanged.
+	for(size_t j = 0; j < (sizeof(strs) / sizeof(strs[0])); j++) {
+		val_32_a = val_32_b = 0x55555555;
+		len_a = strtou32_ref(strs[j], &val_32_a);
+		len_b = strtou32(strs[j], &val_32_b);
+		printf("\"%s\": strtou32_ref = %lu (%u), strtou32 = %lu (%u) - %s\n", strs[j], val_32_a, len_a, val_32_b, len_b, (len_a == len_b && val_32_a == val_32_b ? pass_str : fail_str));
+		count_test_result(len_a == len_b && val_32_a == val_32_b, result);
+
+		val_16_a = val_16_b = 0x5555;
+		len_a = strtou16_ref(strs[j], &val_16_a);
+		len_b = strtou16(strs[j], &val_16_b);
+		printf("\"%s\": strtou16_ref = %u (%u), strtou16 = %u (%u) - %s\n", strs[j], val_16_a, len_a, val_16_b, len_b, (len_a == len_b && val_16_a == val_16_b ? pass_str : fail_str));
+		count_test_result(len_a == len_b && val_16_a == val_16_b, result);
+	}
+}
+
+static void benchmark_strtou(void) {
+	uint16_t val_16;
+	uint32_t val_32;
+
+	// Compare against parsing with atol and strtoul, as would otherwise be
+	// used. Values with the maximum number of digits are used, as execution
+	// time increases with the number of digits.
+
+	benchmark("atol (16-bit)", atol("65535"));
+	benchmark("strtou16_ref", strtou16_ref("65535", &val_16));
+	benchmark("strtou16", strtou16("65535", &val_16));
+	benchmark("atol (32-bit)", atol("2147483647"));
+	benchmark("strtoul (10)", strtoul("4294967295", NULL, 10));
+	benchmark("strtou32_ref", strtou32_ref("4294967295", &val_32));
+	benchmark("strtou32", strtou32("4294967295", &val_32));
+}
+
+static void test_sat(test_result_t *result) {
+	static const uint16_t vals_u16[] = { 0U, 1U, 2U, 0x7FFFU, 0x8000U, 0x8001U, 0xFFFEU, 0xFFFFU };
+	static const int16_t vals_s16[] = { 0, 1, -1, 2, -2, 0x3FFF, -0x4000, INT16_MAX - 1, INT16_MAX, INT16_MIN + 1, INT16_MIN };
+	static const uint32_t vals_u32[] = { 0UL, 1UL, 2UL, 0xFFFFUL, 0x10000UL, 0x7FFFFFFFUL, 0x80000000UL, 0x80000001UL, 0xFFFFFFFEUL, 0xFFFFFFFFUL };
+	static const int32_t vals_s32[] = { 0L, 1L, -1L, 2L, -2L, 0xFFFFL, -0x10000L, 0x3FFFFFFFL, -0x40000000L, INT32_MAX - 1, INT32_MAX, INT32_MIN + 1, INT32_MIN };
+	static const int32_t vals_narrow[] = { 0L, 1L, -1L, 127L, 128L, -128L, -129L, INT16_MAX, INT16_MAX + 1L, INT16_MIN, INT16_MIN - 1L, 0xFFFFL, -0x10000L, 0x18000L, -0x18000L, INT32_MAX, INT32_MIN };
+	uint16_t fail_count;
+	uint16_t i;
+
+	// Exhaustively test all combinations of 8-bit values, only printing a line
+	// for the first failure (if any) and a summary at the end.
+	fail_count = 0;
+	i = 0;
+	do {
+		uint8_t a = i >> 8, b = i & 0xFF;
+		if(sat_add_u8(a, b) != sat_add_u8_ref(a, b) || sat_sub_u8(a, b) != sat_sub_u8_ref(a, b)) {
+			if(fail_count++ == 0) printf("%u, %u: sat_add_u8 = %u, sat_sub_u8 = %u - %s\n", a, b, sat_add_u8(a, b), sat_sub_u8(a, b), fail_str);
+		}
+		if(sat_add_s8((int8_t)a, (int8_t)b) != sat_add_s8_ref((int8_t)a, (int8_t)b) || sat_sub_s8((int8_t)a, (int8_t)b) != sat_sub_s8_ref((int8_t)a, (int8_t)b)) {
+			if(fail_count++ == 0) printf("%d, %d: sat_add_s8 = %d, sat_sub_s8 = %d - %s\n", (int8_t)a, (int8_t)b, sat_add_s8((int8_t)a, (int8_t)b), sat_sub_s8((int8_t)a, (int8_t)b), fail_str);
+		}
+	} while(++i);
+	printf("sat_add_u8/s8, sat_sub_u8/s8: all values, failures = %u - %s\n", fail_count, (fail_count == 0 ? pass_str : fail_str));
+	count_test_result(fail_count == 0, result);
+
+	fail_count = 0;
+	i = 0;
+	do {
+		if(sat_narrow_s16_s8((int16_t)i) != sat_narrow_s16_s8_ref((int16_t)i)) {
+			if(fail_count++ == 0) printf("%d: sat_narrow_s16_s8 = %d - %s\n", (int16_t)i, sat_narrow_s16_s8((int16_t)i), fail_str);
+		}
+	} while(++i);
+	printf("sat_narrow_s16_s8: all values, failures = %u - %s\n", fail_count, (fail_count == 0 ? pass_str : fail_str));
+	count_test_result(fail_count == 0, result);
+
+	// Test every pair of edge-case values for the wider widths, in both
+	// orders, including those either side of the saturation limits.
+	for(size_t j = 0; j < (sizeof(vals_u16) / sizeof(vals_u16[0])); j++) {
+		for(size_t k = 0; k < (sizeof(vals_u16) / sizeof(vals_u16[0])); k++) {
+			uint16_t add_a = sat_add_u16_ref(vals_u16[j], vals_u16[k]), add_b = sat_add_u16(vals_u16[j], vals_u16[k]);
+			uint16_t sub_a = sat_sub_u16_ref(vals_u16[j], vals_u16[k]), sub_b = sat_sub_u16(vals_u16[j], vals_u16[k]);
+			printf("0x%04X, 0x%04X: sat_add_u16_ref = 0x%04X, sat_add_u16 = 0x%04X, sat_sub_u16_ref = 0x%04X, sat_sub_u16 = 0x%04X - %s\n", vals_u16[j], vals_u16[k], add_a, add_b, sub_a, sub_b, (add_a == add_b && sub_a == sub_b ? pass_str : fail_str));
+			count_test_result(add_a == add_b && sub_a == sub_b, result);
+		}
+	}
+
+	for(size_t j = 0; j < (sizeof(vals_s16) / sizeof(vals_s16[0])); j++) {
+		for(size_t k = 0; k < (sizeof(vals_s16) / sizeof(vals_s16[0])); k++) {
+			int16_t add_a = sat_add_s16_ref(vals_s16[j], vals_s16[k]), add_b = sat_add_s16(vals_s16[j], vals_s16[k]);
+			int16_t sub_a = sat_sub_s16_ref(vals_s16[j], vals_s16[k]), sub_b = sat_sub_s16(vals_s16[j], vals_s16[k]);
+			printf("%d, %d: sat_add_s16_ref = %d, sat_add_s16 = %d, sat_sub_s16_ref = %d, sat_sub_s16 = %d - %s\n", vals_s16[j], vals_s16[k], add_a, add_b, sub_a, sub_b, (add_a == add_b && sub_a == sub_b ? pass_str : fail_str));
+			count_test_result(add_a == add_b && sub_a == sub_b, result);
+		}
+	}
+
+	for(size_t j = 0; j < (sizeof(vals_u32) / sizeof(vals_u32[0])); j++) {
+		for(size_t k = 0; k < (sizeof(vals_u32) / sizeof(vals_u32[0])); k++) {
+			uint32_t add_a = sat_add_u32_ref(vals_u32[j], vals_u32[k]), add_b = sat_add_u32(vals_u32[j], vals_u32[k]);
+			uint32_t sub_a = sat_sub_u32_ref(vals_u32[j], vals_u32[k]), sub_b = sat_sub_u32(vals_u32[j], vals_u32[k]);
+			printf("0x%08lX, 0x%08lX: sat_add_u32_ref = 0x%08lX, sat_add_u32 = 0x%08lX, sat_sub_u32_ref = 0x%08lX, sat_sub_u32 = 0x%08lX - %s\n", vals_u32[j], vals_u32[k], add_a, add_b, sub_a, sub_b, (add_a == add_b && sub_a == sub_b ? pass_str : fail_str));
+			count_test_result(add_a == add_b && sub_a == sub_b, result);
+		}
+	}
+
+	for(size_t j = 0; j < (sizeof(vals_s32) / sizeof(vals_s32[0])); j++) {
+		for(size_t k = 0; k < (sizeof(vals_s32) / sizeof(vals_s32[0])); k++) {
+			int32_t add_a = sat_add_s32_ref(vals_s32[j], vals_s32[k]), add_b = sat_add_s32(vals_s32[j], vals_s32[k]);
+			int32_t sub_a = sat_sub_s32_ref(vals_s32[j], vals_s32[k]), sub_b = sat_sub_s32(vals_s32[j], vals_s32[k]);
+			printf("%ld, %ld: sat_add_s32_ref = %ld, sat_add_s32 = %ld, sat_sub_s32_ref = %ld, sat_sub_s32 = %ld - %s\n", vals_s32[j], vals_s32[k], add_a, add_b, sub_a, sub_b, (add_a == add_b && sub_a == sub_b ? pass_str : fail_str));
+			count_test_result(add_a == add_b && sub_a == sub_b, result);
+		}
+	}
+
+	for(size_t j = 0; j < (sizeof(vals_narrow) / sizeof(vals_narrow[0])); j++) {
+		int16_t foo = sat_narrow_s32_s16_ref(vals_narrow[j]);
+		int16_t bar = sat_narrow_s32_s16(vals_narrow[j]);
+		printf("%ld: sat_narrow_s32_s16_ref = %d, sat_narrow_s32_s16 = %d - %s\n", vals_narrow[j], foo, bar, (foo == bar ? pass_str : fail_str));
+		count_test_result(foo == bar, result);
+	}
+}
+
+static void benchmark_sat(void) {
+	static const uint8_t val_u8 = 200;
+	static const int8_t val_s8 = 100;
+	static const uint16_t val_u16 = 50000U;
+	static const int16_t val_s16 = 20000;
+	static const uint32_t val_u32 = 3000000000UL;
+	static const int32_t val_s32 = 1500000000L;
+
+	// Compare against the C clamp idiom of the reference functions. The values
+	// are chosen so that every operation saturates.
+
+	benchmark("sat_add_u8_ref", sat_add_u8_ref(val_u8, val_u8));
+	benchmark("sat_add_u8", sat_add_u8(val_u8, val_u8));
+	benchmark("sat_add_s8_ref", sat_add_s8_ref(val_s8, val_s8));
+	benchmark("sat_add_s8", sat_add_s8(val_s8, val_s8));
+	benchmark("sat_add_u16_ref", sat_add_u16_ref(val_u16, val_u16));
+	benchmark("sat_add_u16", sat_add_u16(val_u16, val_u16));
+	benchmark("sat_add_s16_ref", sat_add_s16_ref(val_s16, val_s16));
+	benchmark("sat_add_s16", sat_add_s16(val_s16, val_s16));
+	benchmark("sat_add_u32_ref", sat_add_u32_ref(val_u32, val_u32));
+	benchmark("sat_add_u32", sat_add_u32(val_u32, val_u32));
+	benchmark("sat_add_s32_ref", sat_add_s32_ref(val_s32, val_s32));
+	benchmark("sat_add_s32", sat_add_s32(val_s32, val_s32));
+	benchmark("sat_sub_u8_ref", sat_sub_u8_ref(val_s8, val_u8));
+	benchmark("sat_sub_u8", sat_sub_u8(val_s8, val_u8));
+	benchmark("sat_sub_s8_ref", sat_sub_s8_ref(-val_s8, val_s8));
+	benchmark("sat_sub_s8", sat_sub_s8(-val_s8, val_s8));
+	benchmark("sat_sub_u16_ref", sat_sub_u16_ref(val_s16, val_u16));
+	benchmark("sat_sub_u16", sat_sub_u16(val_s16, val_u16));
+	benchmark("sat_sub_s16_ref", sat_sub_s16_ref(-val_s16, val_s16));
+	benchmark("sat_sub_s16", sat_sub_s16(-val_s16, val_s16));
+	benchmark("sat_sub_u32_ref", sat_sub_u32_ref(val_s32, val_u32));
+	benchmark("sat_sub_u32", sat_sub_u32(val_s32, val_u32));
+	benchmark("sat_sub_s32_ref", sat_sub_s32_ref(-val_s32, val_s32));
+	benchmark("sat_sub_s32", sat_sub_s32(-val_s32, val_s32));
+	benchmark("sat_narrow_s16_s8_ref", sat_narrow_s16_s8_ref(val_s16));
+	benchmark("sat_narrow_s16_s8", sat_narrow_s16_s8(val_s16));
+	benchmark("sat_narrow_s32_s16_ref", sat_narrow_s32_s16_ref(val_s32));
+	benchmark("sat_narrow_s32_s16", sat_narrow_s32_s16(val_s32));
 }
 
 void main(void) {
@@ -677,10 +2508,24 @@ void main(void) {
 	test_swap(&results);
 	test_reflect(&results);
 	test_ctz_clz_ffs(&results);
+	test_bitmap(&results);
+	test_bitset(&results);
 	test_pop_count(&results);
+	test_pop_count_buf(&results);
 	test_rotate(&results);
 	test_div(&results);
+	test_div_const(&results);
+	test_mul(&results);
+	test_isqrt(&results);
 	test_strctcmp(&results);
+	test_memctcmp(&results);
+	test_crc(&results);
+	test_checksum(&results);
+	test_utoa(&results);
+	test_bcd(&results);
+	test_hex(&results);
+	test_strtou(&results);
+	test_sat(&results);
 
 	printf("TOTAL RESULTS: passed = %u, failed = %u\n", results.pass_count, results.fail_count);
 
@@ -689,18 +2534,30 @@ void main(void) {
 	benchmark_swap();
 	benchmark_reflect();
 	benchmark_pop_count();
+	benchmark_pop_count_buf();
 	benchmark_ctz_clz_ffs();
+	benchmark_bitmap();
+	benchmark_bitset();
 	benchmark_rotate();
 	benchmark_div();
+	benchmark_mul();
+	benchmark_isqrt();
 	benchmark_strctcmp();
+	benchmark_memctcmp();
+	benchmark_crc();
+	benchmark_checksum();
+	benchmark_utoa();
+	benchmark_bcd();
+	benchmark_hex();
+	benchmark_strtou();
+	benchmark_sat();
 
 	puts(hrule_str);
 
-	/*
 	benchmark_rotate_linearity();
+	benchmark_div_magnitude();
 
 	puts(hrule_str);
-	*/
 
 	if(ucsim_if_detect()) {
 		ucsim_if_stop();
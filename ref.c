@@ -41,6 +41,28 @@ uint32_t bswap_32_ref(const uint32_t value) {
 	return ((value & 0x000000FFUL) << 24) | ((value & 0x0000FF00UL) << 8) | ((value & 0x00FF0000UL) >> 8) | ((value & 0xFF000000UL) >> 24);
 }
 
+void bswap_16_buf_ref(uint16_t *buf, uint16_t count) {
+	while(count--) {
+		*buf = bswap_16_ref(*buf);
+		buf++;
+	}
+}
+
+void bswap_16_buf_copy_ref(uint16_t *dst, const uint16_t *src, uint16_t count) {
+	while(count--) *dst++ = bswap_16_ref(*src++);
+}
+
+void bswap_32_buf_ref(uint32_t *buf, uint16_t count) {
+	while(count--) {
+		*buf = bswap_32_ref(*buf);
+		buf++;
+	}
+}
+
+void bswap_32_buf_copy_ref(uint32_t *dst, const uint32_t *src, uint16_t count) {
+	while(count--) *dst++ = bswap_32_ref(*src++);
+}
+
 uint8_t reflect_8_ref(uint8_t value) {
 	uint8_t result = value;
 	uint8_t shifts = (sizeof(value) * CHAR_BIT) - 1;
@@ -83,6 +105,10 @@ uint32_t reflect_32_ref(uint32_t value) {
 	return result;
 }
 
+void reflect_buf_ref(uint8_t *dst, const uint8_t *src, uint16_t len) {
+	while(len--) *dst++ = reflect_8_ref(*src++);
+}
+
 uint8_t ctz_8_ref(uint8_t value) {
 	uint8_t c = 0;
 	if(value) {
@@ -182,6 +208,24 @@ uint8_t ffs_32_ref(uint32_t value) {
 	return (value ? ctz_32_ref(value) + 1 : 0);
 }
 
+uint16_t ffs_bitmap_ref(const uint8_t *bitmap, uint16_t len) {
+	return ffs_bitmap_next_ref(bitmap, len, 0);
+}
+
+uint16_t ffs_bitmap_next_ref(const uint8_t *bitmap, uint16_t len, uint16_t pos) {
+	for(uint32_t i = pos; i < (uint32_t)len * CHAR_BIT; i++) {
+		if(bitmap[i / CHAR_BIT] & (1 << (i % CHAR_BIT))) return i + 1;
+	}
+	return 0;
+}
+
+uint16_t fls_bitmap_ref(const uint8_t *bitmap, uint16_t len) {
+	for(uint32_t i = (uint32_t)len * CHAR_BIT; i > 0; i--) {
+		if(bitmap[(i - 1) / CHAR_BIT] & (1 << ((i - 1) % CHAR_BIT))) return i;
+	}
+	return 0;
+}
+
 uint8_t pop_count_8_ref(uint8_t value) {
 	uint8_t c = 0;
 	while(value) {
@@ -212,6 +256,18 @@ uint8_t pop_count_32_ref(uint32_t value) {
 	return c;
 }
 
+uint16_t pop_count_buf_ref(const uint8_t *buf, uint16_t len) {
+	uint16_t c = 0;
+	while(len--) c += pop_count_8_ref(*buf++);
+	return c;
+}
+
+uint16_t hamming_buf_ref(const uint8_t *a, const uint8_t *b, uint16_t len) {
+	uint16_t c = 0;
+	while(len--) c += pop_count_8_ref(*a++ ^ *b++);
+	return c;
+}
+
 uint8_t rotate_left_8_ref(uint8_t value, uint8_t count) {
 	const uint8_t mask = CHAR_BIT * sizeof(value) - 1;
 	count &= mask;
@@ -258,7 +314,331 @@ void div_u16_ref(uint16_t x, uint16_t y, div_u16_t *result) {
 	result->rem = x % y;
 }
 
+void div_s32_ref(int32_t x, int32_t y, div_s32_t *result) {
+	result->quot = x / y;
+	result->rem = x % y;
+}
+
 void div_u32_ref(uint32_t x, uint32_t y, div_u32_t *result) {
 	result->quot = x / y;
 	result->rem = x % y;
 }
+
+void div_u16_u8_ref(uint16_t x, uint8_t y, div_u16_u8_t *result) {
+	result->quot = x / y;
+	result->rem = x % y;
+}
+
+void div_u32_u8_ref(uint32_t x, uint8_t y, div_u32_u8_t *result) {
+	result->quot = x / y;
+	result->rem = x % y;
+}
+
+int32_t mul_s16_s32_ref(int16_t a, int16_t b) {
+	return (int32_t)a * b;
+}
+
+uint32_t mul_u16_u32_ref(uint16_t a, uint16_t b) {
+	return (uint32_t)a * b;
+}
+
+void mul_s32_s64_ref(int32_t a, int32_t b, mul_s64_t *result) {
+	const int64_t product = (int64_t)a * b;
+	result->hi = product >> 32;
+	result->lo = product;
+}
+
+void mul_u32_u64_ref(uint32_t a, uint32_t b, mul_u64_t *result) {
+	const uint64_t product = (uint64_t)a * b;
+	result->hi = product >> 32;
+	result->lo = product;
+}
+
+uint8_t isqrt_16_ref(uint16_t value) {
+	uint16_t root = 0;
+	uint16_t bit = 1U << 14;
+
+	// Start with the highest power of four not greater than the value.
+	while(bit > value) bit >>= 2;
+
+	while(bit) {
+		if(value >= root + bit) {
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		} else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	return root;
+}
+
+uint16_t isqrt_32_ref(uint32_t value) {
+	uint32_t root = 0;
+	uint32_t bit = 1UL << 30;
+
+	// Start with the highest power of four not greater than the value.
+	while(bit > value) bit >>= 2;
+
+	while(bit) {
+		if(value >= root + bit) {
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		} else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	return root;
+}
+
+uint8_t crc_8_update_ref(uint8_t crc, const uint8_t *buf, uint16_t len) {
+	while(len--) {
+		crc ^= *buf++;
+		for(uint8_t i = 0; i < CHAR_BIT; i++) {
+			crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+		}
+	}
+	return crc;
+}
+
+uint16_t crc_16_ccitt_update_ref(uint16_t crc, const uint8_t *buf, uint16_t len) {
+	while(len--) {
+		crc ^= (uint16_t)*buf++ << 8;
+		for(uint8_t i = 0; i < CHAR_BIT; i++) {
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+		}
+	}
+	return crc;
+}
+
+uint16_t crc_16_modbus_update_ref(uint16_t crc, const uint8_t *buf, uint16_t len) {
+	while(len--) {
+		crc ^= *buf++;
+		for(uint8_t i = 0; i < CHAR_BIT; i++) {
+			crc = (crc & 1) ? (crc >> 1) ^ 0xA001 : crc >> 1;
+		}
+	}
+	return crc;
+}
+
+uint32_t crc_32_update_ref(uint32_t crc, const uint8_t *buf, uint16_t len) {
+	while(len--) {
+		crc ^= *buf++;
+		for(uint8_t i = 0; i < CHAR_BIT; i++) {
+			crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320UL : crc >> 1;
+		}
+	}
+	return crc;
+}
+
+uint16_t fletcher_16_update_ref(uint16_t sum, const uint8_t *buf, uint16_t len) {
+	uint16_t sum1 = sum & 0xFF;
+	uint16_t sum2 = sum >> 8;
+	while(len--) {
+		sum1 = (sum1 + *buf++) % 255;
+		sum2 = (sum2 + sum1) % 255;
+	}
+	return (sum2 << 8) | sum1;
+}
+
+uint32_t adler_32_update_ref(uint32_t sum, const uint8_t *buf, uint16_t len) {
+	uint32_t a = sum & 0xFFFF;
+	uint32_t b = sum >> 16;
+	while(len--) {
+		a = (a + *buf++) % 65521;
+		b = (b + a) % 65521;
+	}
+	return (b << 16) | a;
+}
+
+uint16_t ones_sum_16_update_ref(uint16_t sum, const uint8_t *buf, uint16_t len) {
+	uint32_t acc = sum;
+	while(len > 1) {
+		acc += ((uint16_t)buf[0] << 8) | buf[1];
+		buf += 2;
+		len -= 2;
+	}
+	if(len) acc += (uint16_t)buf[0] << 8;
+	// Fold the carries back in until none remain.
+	while(acc >> 16) acc = (acc & 0xFFFF) + (acc >> 16);
+	return acc;
+}
+
+uint8_t utoa_16_ref(uint16_t value, char *buf) {
+	return utoa_32_ref(value, buf);
+}
+
+uint8_t utoa_32_ref(uint32_t value, char *buf) {
+	char tmp[10];
+	uint8_t len = 0;
+	// Digits are produced least-significant first, so reverse them afterwards.
+	do {
+		tmp[len++] = '0' + (value % 10);
+		value /= 10;
+	} while(value);
+	for(uint8_t i = 0; i < len; i++) buf[i] = tmp[len - 1 - i];
+	buf[len] = '\0';
+	return len;
+}
+
+uint8_t itoa_16_ref(int16_t value, char *buf) {
+	return itoa_32_ref(value, buf);
+}
+
+uint8_t itoa_32_ref(int32_t value, char *buf) {
+	if(value < 0) {
+		*buf = '-';
+		return utoa_32_ref(-(uint32_t)value, buf + 1) + 1;
+	}
+	return utoa_32_ref(value, buf);
+}
+
+uint8_t strtou16_ref(const char *str, uint16_t *value) {
+	uint32_t result;
+	uint8_t count = strtou32_ref(str, &result);
+	if(count == 0 || result > UINT16_MAX) return 0;
+	*value = result;
+	return count;
+}
+
+uint8_t strtou32_ref(const char *str, uint32_t *value) {
+	uint32_t result = 0;
+	uint16_t count = 0;
+	while(str[count] >= '0' && str[count] <= '9') {
+		uint8_t digit = str[count++] - '0';
+		if(result > (UINT32_MAX - digit) / 10) return 0;
+		result = (result * 10) + digit;
+	}
+	if(count == 0 || count > UINT8_MAX) return 0;
+	*value = result;
+	return count;
+}
+
+uint32_t bin2bcd_16_ref(uint16_t value) {
+	uint32_t bcd = 0;
+	for(uint8_t shift = 0; value; shift += 4) {
+		bcd |= (uint32_t)(value % 10) << shift;
+		value /= 10;
+	}
+	return bcd;
+}
+
+void bin2bcd_32_ref(uint32_t value, uint8_t *bcd) {
+	for(uint8_t i = 5; i > 0; i--) {
+		bcd[i - 1] = ((value / 10 % 10) << 4) | (value % 10);
+		value /= 100;
+	}
+}
+
+uint16_t bcd2bin_16_ref(uint32_t bcd) {
+	uint16_t value = 0;
+	for(uint8_t shift = 20; shift > 0; shift -= 4) {
+		value = (value * 10) + ((bcd >> (shift - 4)) & 0xF);
+	}
+	return value;
+}
+
+uint32_t bcd2bin_32_ref(const uint8_t *bcd) {
+	uint32_t value = 0;
+	for(uint8_t i = 0; i < 5; i++) {
+		value = (value * 100) + ((bcd[i] >> 4) * 10) + (bcd[i] & 0xF);
+	}
+	return value;
+}
+
+void hex_encode_buf_ref(char *dst, const uint8_t *src, uint16_t len, bool lower) {
+	const char *digits = (lower ? "0123456789abcdef" : "0123456789ABCDEF");
+	while(len--) {
+		*dst++ = digits[*src >> 4];
+		*dst++ = digits[*src & 0xF];
+		src++;
+	}
+	*dst = '\0';
+}
+
+static int8_t hex_digit_ref(char c) {
+	if(c >= '0' && c <= '9') return c - '0';
+	if(c >= 'A' && c <= 'F') return c - 'A' + 10;
+	if(c >= 'a' && c <= 'f') return c - 'a' + 10;
+	return -1;
+}
+
+bool hex_decode_buf_ref(uint8_t *dst, const char *src, uint16_t len) {
+	while(len--) {
+		int8_t hi = hex_digit_ref(*src++);
+		if(hi < 0) return false;
+		int8_t lo = hex_digit_ref(*src++);
+		if(lo < 0) return false;
+		*dst++ = (hi << 4) | lo;
+	}
+	return true;
+}
+
+uint8_t sat_add_u8_ref(uint8_t a, uint8_t b) {
+	uint16_t r = (uint16_t)a + b;
+	return (r > UINT8_MAX ? UINT8_MAX : r);
+}
+
+int8_t sat_add_s8_ref(int8_t a, int8_t b) {
+	int16_t r = (int16_t)a + b;
+	return (r > INT8_MAX ? INT8_MAX : (r < INT8_MIN ? INT8_MIN : r));
+}
+
+uint16_t sat_add_u16_ref(uint16_t a, uint16_t b) {
+	uint32_t r = (uint32_t)a + b;
+	return (r > UINT16_MAX ? UINT16_MAX : r);
+}
+
+int16_t sat_add_s16_ref(int16_t a, int16_t b) {
+	int32_t r = (int32_t)a + b;
+	return (r > INT16_MAX ? INT16_MAX : (r < INT16_MIN ? INT16_MIN : r));
+}
+
+uint32_t sat_add_u32_ref(uint32_t a, uint32_t b) {
+	return (a > UINT32_MAX - b ? UINT32_MAX : a + b);
+}
+
+int32_t sat_add_s32_ref(int32_t a, int32_t b) {
+	if(b > 0 && a > INT32_MAX - b) return INT32_MAX;
+	if(b < 0 && a < INT32_MIN - b) return INT32_MIN;
+	return a + b;
+}
+
+uint8_t sat_sub_u8_ref(uint8_t a, uint8_t b) {
+	return (b > a ? 0 : a - b);
+}
+
+int8_t sat_sub_s8_ref(int8_t a, int8_t b) {
+	int16_t r = (int16_t)a - b;
+	return (r > INT8_MAX ? INT8_MAX : (r < INT8_MIN ? INT8_MIN : r));
+}
+
+uint16_t sat_sub_u16_ref(uint16_t a, uint16_t b) {
+	return (b > a ? 0 : a - b);
+}
+
+int16_t sat_sub_s16_ref(int16_t a, int16_t b) {
+	int32_t r = (int32_t)a - b;
+	return (r > INT16_MAX ? INT16_MAX : (r < INT16_MIN ? INT16_MIN : r));
+}
+
+uint32_t sat_sub_u32_ref(uint32_t a, uint32_t b) {
+	return (b > a ? 0 : a - b);
+}
+
+int32_t sat_sub_s32_ref(int32_t a, int32_t b) {
+	if(b < 0 && a > INT32_MAX + b) return INT32_MAX;
+	if(b > 0 && a < INT32_MIN + b) return INT32_MIN;
+	return a - b;
+}
+
+int8_t sat_narrow_s16_s8_ref(int16_t value) {
+	return (value > INT8_MAX ? INT8_MAX : (value < INT8_MIN ? INT8_MIN : value));
+}
+
+int16_t sat_narrow_s32_s16_ref(int32_t value) {
+	return (value > INT16_MAX ? INT16_MAX : (value < INT16_MIN ? INT16_MIN : value));
+}
@@ -33,14 +33,21 @@
 extern uint8_t swap_ref(const uint8_t value);
 extern uint16_t bswap_16_ref(const uint16_t value);
 extern uint32_t bswap_32_ref(const uint32_t value);
+extern void bswap_16_buf_ref(uint16_t *buf, uint16_t count);
+extern void bswap_16_buf_copy_ref(uint16_t *dst, const uint16_t *src, uint16_t count);
+extern void bswap_32_buf_ref(uint32_t *buf, uint16_t count);
+extern void bswap_32_buf_copy_ref(uint32_t *dst, const uint32_t *src, uint16_t count);
 
 extern uint8_t reflect_8_ref(uint8_t value);
 extern uint16_t reflect_16_ref(uint16_t value);
 extern uint32_t reflect_32_ref(uint32_t value);
+extern void reflect_buf_ref(uint8_t *dst, const uint8_t *src, uint16_t len);
 
 extern uint8_t pop_count_8_ref(uint8_t value);
 extern uint8_t pop_count_16_ref(uint16_t value);
 extern uint8_t pop_count_32_ref(uint32_t value);
+extern uint16_t pop_count_buf_ref(const uint8_t *buf, uint16_t len);
+extern uint16_t hamming_buf_ref(const uint8_t *a, const uint8_t *b, uint16_t len);
 
 extern uint8_t ctz_8_ref(uint8_t value);
 extern uint8_t ctz_16_ref(uint16_t value);
@@ -53,6 +60,9 @@ extern uint8_t clz_32_ref(uint32_t value);
 extern uint8_t ffs_8_ref(uint8_t value);
 extern uint8_t ffs_16_ref(uint16_t value);
 extern uint8_t ffs_32_ref(uint32_t value);
+extern uint16_t ffs_bitmap_ref(const uint8_t *bitmap, uint16_t len);
+extern uint16_t ffs_bitmap_next_ref(const uint8_t *bitmap, uint16_t len, uint16_t pos);
+extern uint16_t fls_bitmap_ref(const uint8_t *bitmap, uint16_t len);
 
 extern uint8_t rotate_left_8_ref(uint8_t value, uint8_t count);
 extern uint8_t rotate_right_8_ref(uint8_t value, uint8_t count);
@@ -63,6 +73,56 @@ extern uint32_t rotate_right_32_ref(uint32_t value, uint8_t count);
 
 extern void div_s16_ref(int16_t x, int16_t y, div_s16_t *result);
 extern void div_u16_ref(uint16_t x, uint16_t y, div_u16_t *result);
+extern void div_s32_ref(int32_t x, int32_t y, div_s32_t *result);
 extern void div_u32_ref(uint32_t x, uint32_t y, div_u32_t *result);
+extern void div_u16_u8_ref(uint16_t x, uint8_t y, div_u16_u8_t *result);
+extern void div_u32_u8_ref(uint32_t x, uint8_t y, div_u32_u8_t *result);
+
+extern int32_t mul_s16_s32_ref(int16_t a, int16_t b);
+extern uint32_t mul_u16_u32_ref(uint16_t a, uint16_t b);
+extern void mul_s32_s64_ref(int32_t a, int32_t b, mul_s64_t *result);
+extern void mul_u32_u64_ref(uint32_t a, uint32_t b, mul_u64_t *result);
+
+extern uint8_t isqrt_16_ref(uint16_t value);
+extern uint16_t isqrt_32_ref(uint32_t value);
+
+extern uint8_t crc_8_update_ref(uint8_t crc, const uint8_t *buf, uint16_t len);
+extern uint16_t crc_16_ccitt_update_ref(uint16_t crc, const uint8_t *buf, uint16_t len);
+extern uint16_t crc_16_modbus_update_ref(uint16_t crc, const uint8_t *buf, uint16_t len);
+extern uint32_t crc_32_update_ref(uint32_t crc, const uint8_t *buf, uint16_t len);
+
+extern uint16_t fletcher_16_update_ref(uint16_t sum, const uint8_t *buf, uint16_t len);
+extern uint32_t adler_32_update_ref(uint32_t sum, const uint8_t *buf, uint16_t len);
+extern uint16_t ones_sum_16_update_ref(uint16_t sum, const uint8_t *buf, uint16_t len);
+
+extern uint8_t utoa_16_ref(uint16_t value, char *buf);
+extern uint8_t utoa_32_ref(uint32_t value, char *buf);
+extern uint8_t itoa_16_ref(int16_t value, char *buf);
+extern uint8_t itoa_32_ref(int32_t value, char *buf);
+extern uint8_t strtou16_ref(const char *str, uint16_t *value);
+extern uint8_t strtou32_ref(const char *str, uint32_t *value);
+
+extern uint32_t bin2bcd_16_ref(uint16_t value);
+extern void bin2bcd_32_ref(uint32_t value, uint8_t *bcd);
+extern uint16_t bcd2bin_16_ref(uint32_t bcd);
+extern uint32_t bcd2bin_32_ref(const uint8_t *bcd);
+
+extern void hex_encode_buf_ref(char *dst, const uint8_t *src, uint16_t len, bool lower);
+extern bool hex_decode_buf_ref(uint8_t *dst, const char *src, uint16_t len);
+
+extern uint8_t sat_add_u8_ref(uint8_t a, uint8_t b);
+extern int8_t sat_add_s8_ref(int8_t a, int8_t b);
+extern uint16_t sat_add_u16_ref(uint16_t a, uint16_t b);
+extern int16_t sat_add_s16_ref(int16_t a, int16_t b);
+extern uint32_t sat_add_u32_ref(uint32_t a, uint32_t b);
+extern int32_t sat_add_s32_ref(int32_t a, int32_t b);
+extern uint8_t sat_sub_u8_ref(uint8_t a, uint8_t b);
+extern int8_t sat_sub_s8_ref(int8_t a, int8_t b);
+extern uint16_t sat_sub_u16_ref(uint16_t a, uint16_t b);
+extern int16_t sat_sub_s16_ref(int16_t a, int16_t b);
+extern uint32_t sat_sub_u32_ref(uint32_t a, uint32_t b);
+extern int32_t sat_sub_s32_ref(int32_t a, int32_t b);
+extern int8_t sat_narrow_s16_s8_ref(int16_t value);
+extern int16_t sat_narrow_s32_s16_ref(int32_t value);
 
 #endif // REF_H_
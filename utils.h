@@ -27,16 +27,22 @@
 #ifndef UTILS_H_
 #define UTILS_H_
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
-// Short-term fix to force usage of old ABI when compiled with SDCC v4.2.0
-// (or newer). New ABI passes simple arguments (e.g. one or two 8- or 16-bit
-// values) in A/X registers, versus previous where all args are on the stack.
-// Eventually, all assembly code should be changed to use new ABI. May actually
-// offer a performance increase, eliminating code that simply takes arg values
-// and loads them to A/X registers.
-#if defined(__SDCCCALL) && __SDCCCALL != 0
+// The library routines were originally written for the old SDCC ABI, where
+// all arguments are passed on the stack. SDCC v4.2.0 (and newer) default to a
+// new ABI that passes simple arguments (e.g. one or two 8- or 16-bit values)
+// in A/X registers instead. The original stack-argument entry points are kept
+// with their old ABI forced, so they may be used from code compiled with any
+// SDCC version. Where the new ABI passes all of a function's arguments in
+// registers, an additional entry point (suffixed '_ra') is also provided that
+// takes its arguments directly in A/X, eliminating the code that simply loads
+// argument values from the stack.
+#if defined(__SDCCCALL)
 #define __stack_args __sdcccall(0)
+#define __reg_args __sdcccall(1)
 #else
 #define __stack_args
 #endif
@@ -51,27 +57,71 @@ typedef struct {
 	uint16_t rem;
 } div_u16_t;
 
+typedef struct {
+	int32_t quot;
+	int32_t rem;
+} div_s32_t;
+
 typedef struct {
 	uint32_t quot;
 	uint32_t rem;
 } div_u32_t;
 
+typedef struct {
+	uint16_t quot;
+	uint8_t rem;
+} div_u16_u8_t;
+
+typedef struct {
+	uint32_t quot;
+	uint8_t rem;
+} div_u32_u8_t;
+
+typedef struct {
+	int32_t hi;
+	uint32_t lo;
+} mul_s64_t;
+
+typedef struct {
+	uint32_t hi;
+	uint32_t lo;
+} mul_u64_t;
+
+typedef struct {
+	uint8_t *bitmap;
+	uint16_t slots;
+	uint16_t len;
+	uint16_t next;
+} bitset_t;
+
+#define BITSET_STORAGE_SIZE(slots) (((slots) + 7) / 8)
+#define BITSET_NONE 0xFFFF
+
 typedef div_s16_t div_t;
+typedef div_s32_t ldiv_t;
 
 /******************************************************************************/
 
 extern uint8_t swap(const uint8_t value) __naked __stack_args;
 extern uint16_t bswap_16(const uint16_t value) __naked __stack_args;
 extern uint32_t bswap_32(const uint32_t value) __naked __stack_args;
+extern void bswap_16_buf(uint16_t *buf, uint16_t count) __naked __stack_args;
+extern void bswap_16_buf_copy(uint16_t *dst, const uint16_t *src, uint16_t count) __naked __stack_args;
+extern void bswap_32_buf(uint32_t *buf, uint16_t count) __naked __stack_args;
+extern void bswap_32_buf_copy(uint32_t *dst, const uint32_t *src, uint16_t count) __naked __stack_args;
 
 extern uint8_t reflect_8(uint8_t value) __naked __stack_args;
 extern uint16_t reflect_16(uint16_t value) __naked __stack_args;
 extern uint32_t reflect_32(uint32_t value) __naked __stack_args;
+extern void reflect_buf(uint8_t *dst, const uint8_t *src, uint16_t len) __naked __stack_args;
 
 extern uint8_t pop_count_8(uint8_t value) __naked __stack_args;
 extern uint8_t pop_count_16(uint16_t value) __naked __stack_args;
 extern uint8_t pop_count_32(uint32_t value) __naked __stack_args;
 
+extern uint16_t pop_count_buf(const uint8_t *buf, uint16_t len) __naked __stack_args;
+extern uint16_t hamming_buf(const uint8_t *a, const uint8_t *b, uint16_t len) __naked __stack_args;
+
 extern uint8_t ctz_8(uint8_t value) __naked __stack_args;
 extern uint8_t ctz_16(uint16_t value) __naked __stack_args;
 extern uint8_t ctz_32(uint32_t value) __naked __stack_args;
@@ -80,9 +130,17 @@ extern uint8_t clz_8(uint8_t value) __naked __stack_args;
 extern uint8_t clz_16(uint16_t value) __naked __stack_args;
 extern uint8_t clz_32(uint32_t value) __naked __stack_args;
 
-extern uint8_t ffs_8(uint8_t value) __stack_args;
-extern uint8_t ffs_16(uint16_t value) __stack_args;
-extern uint8_t ffs_32(uint32_t value) __stack_args;
+extern uint8_t ffs_8(uint8_t value) __naked __stack_args;
+extern uint8_t ffs_16(uint16_t value) __naked __stack_args;
+extern uint8_t ffs_32(uint32_t value) __naked __stack_args;
+extern uint16_t ffs_bitmap(const uint8_t *bitmap, uint16_t len) __naked __stack_args;
+extern uint16_t ffs_bitmap_next(const uint8_t *bitmap, uint16_t len, uint16_t pos) __naked __stack_args;
+extern uint16_t fls_bitmap(const uint8_t *bitmap, uint16_t len) __naked __stack_args;
+
+extern void bitset_init(bitset_t *set, uint8_t *storage, uint16_t slots) __stack_args;
+extern uint16_t bitset_alloc(bitset_t *set) __stack_args;
+extern void bitset_free(bitset_t *set, uint16_t index) __stack_args;
+extern uint16_t bitset_count_free(const bitset_t *set) __stack_args;
 
 extern uint8_t rotate_left_8(uint8_t value, uint8_t count) __naked __stack_args;
 extern uint8_t rotate_right_8(uint8_t value, uint8_t count) __naked __stack_args;
@@ -93,9 +151,103 @@ extern uint32_t rotate_right_32(uint32_t value, uint8_t count) __naked __stack_a
 
 extern void div_s16(int16_t x, int16_t y, div_s16_t *result) __naked __stack_args;
 extern void div_u16(uint16_t x, uint16_t y, div_u16_t *result) __naked __stack_args;
+extern void div_s32(int32_t x, int32_t y, div_s32_t *result) __stack_args;
 extern void div_u32(uint32_t x, uint32_t y, div_u32_t *result) __naked __stack_args;
+extern void div_u16_u8(uint16_t x, uint8_t y, div_u16_u8_t *result) __naked __stack_args;
+extern void div_u32_u8(uint32_t x, uint8_t y, div_u32_u8_t *result) __naked __stack_args;
+
+extern void div_u16_by_10(uint16_t x, div_u16_t *result) __naked __stack_args;
+extern void div_u16_by_60(uint16_t x, div_u16_t *result) __naked __stack_args;
+extern void div_u16_by_100(uint16_t x, div_u16_t *result) __naked __stack_args;
+extern void div_u16_by_1000(uint16_t x, div_u16_t *result) __naked __stack_args;
+extern void div_u32_by_10(uint32_t x, div_u32_t *result) __naked __stack_args;
+extern void div_u32_by_60(uint32_t x, div_u32_t *result) __naked __stack_args;
+extern void div_u32_by_100(uint32_t x, div_u32_t *result) __naked __stack_args;
+extern void div_u32_by_1000(uint32_t x, div_u32_t *result) __naked __stack_args;
+extern void div_u32_by_3600(uint32_t x, div_u32_t *result) __naked __stack_args;
+
+extern int32_t mul_s16_s32(int16_t a, int16_t b) __naked __stack_args;
+extern uint32_t mul_u16_u32(uint16_t a, uint16_t b) __naked __stack_args;
+extern void mul_s32_s64(int32_t a, int32_t b, mul_s64_t *result) __stack_args;
+extern void mul_u32_u64(uint32_t a, uint32_t b, mul_u64_t *result) __naked __stack_args;
+
+extern uint8_t isqrt_16(uint16_t value) __naked __stack_args;
+extern uint16_t isqrt_32(uint32_t value) __naked __stack_args;
 
 extern int strctcmp(const char *s1, const char *s2) __naked __stack_args;
+extern int memctcmp(const void *a, const void *b, size_t n) __naked __stack_args;
+
+extern uint8_t crc_8_update(uint8_t crc, const uint8_t *buf, uint16_t len) __naked __stack_args;
+extern uint16_t crc_16_ccitt_update(uint16_t crc, const uint8_t *buf, uint16_t len) __naked __stack_args;
+extern uint16_t crc_16_modbus_update(uint16_t crc, const uint8_t *buf, uint16_t len) __naked __stack_args;
+extern uint32_t crc_32_update(uint32_t crc, const uint8_t *buf, uint16_t len) __naked __stack_args;
+
+extern uint16_t fletcher_16_update(uint16_t sum, const uint8_t *buf, uint16_t len) __naked __stack_args;
+extern uint32_t adler_32_update(uint32_t sum, const uint8_t *buf, uint16_t len) __naked __stack_args;
+extern uint16_t ones_sum_16_update(uint16_t sum, const uint8_t *buf, uint16_t len) __naked __stack_args;
+
+extern uint8_t utoa_16(uint16_t value, char *buf) __naked __stack_args;
+extern uint8_t utoa_32(uint32_t value, char *buf) __naked __stack_args;
+extern uint8_t itoa_16(int16_t value, char *buf) __stack_args;
+extern uint8_t itoa_32(int32_t value, char *buf) __stack_args;
+extern uint8_t strtou16(const char *str, uint16_t *value) __naked __stack_args;
+extern uint8_t strtou32(const char *str, uint32_t *value) __naked __stack_args;
+
+extern uint32_t bin2bcd_16(uint16_t value) __naked __stack_args;
+extern void bin2bcd_32(uint32_t value, uint8_t *bcd) __naked __stack_args;
+extern uint16_t bcd2bin_16(uint32_t bcd) __naked __stack_args;
+extern uint32_t bcd2bin_32(const uint8_t *bcd) __naked __stack_args;
+
+extern void hex_encode_8(uint8_t value, char *buf, bool lower) __stack_args;
+extern void hex_encode_16(uint16_t value, char *buf, bool lower) __stack_args;
+extern void hex_encode_32(uint32_t value, char *buf, bool lower) __stack_args;
+extern void hex_encode_buf(char *dst, const uint8_t *src, uint16_t len, bool lower) __naked __stack_args;
+extern bool hex_decode_8(const char *str, uint8_t *value) __stack_args;
+extern bool hex_decode_16(const char *str, uint16_t *value) __stack_args;
+extern bool hex_decode_32(const char *str, uint32_t *value) __stack_args;
+extern bool hex_decode_buf(uint8_t *dst, const char *src, uint16_t len) __naked __stack_args;
+
+extern uint8_t sat_add_u8(uint8_t a, uint8_t b) __naked __stack_args;
+extern int8_t sat_add_s8(int8_t a, int8_t b) __naked __stack_args;
+extern uint16_t sat_add_u16(uint16_t a, uint16_t b) __naked __stack_args;
+extern int16_t sat_add_s16(int16_t a, int16_t b) __naked __stack_args;
+extern uint32_t sat_add_u32(uint32_t a, uint32_t b) __naked __stack_args;
+extern int32_t sat_add_s32(int32_t a, int32_t b) __naked __stack_args;
+extern uint8_t sat_sub_u8(uint8_t a, uint8_t b) __naked __stack_args;
+extern int8_t sat_sub_s8(int8_t a, int8_t b) __naked __stack_args;
+extern uint16_t sat_sub_u16(uint16_t a, uint16_t b) __naked __stack_args;
+extern int16_t sat_sub_s16(int16_t a, int16_t b) __naked __stack_args;
+extern uint32_t sat_sub_u32(uint32_t a, uint32_t b) __naked __stack_args;
+extern int32_t sat_sub_s32(int32_t a, int32_t b) __naked __stack_args;
+extern int8_t sat_narrow_s16_s8(int16_t value) __naked __stack_args;
+extern int16_t sat_narrow_s32_s16(int32_t value) __naked __stack_args;
+
+#if defined(__reg_args)
+
+extern uint8_t swap_ra(const uint8_t value) __naked __reg_args;
+extern uint16_t bswap_16_ra(const uint16_t value) __naked __reg_args;
+
+extern uint8_t reflect_8_ra(uint8_t value) __naked __reg_args;
+extern uint16_t reflect_16_ra(uint16_t value) __naked __reg_args;
+
+extern uint8_t pop_count_8_ra(uint8_t value) __naked __reg_args;
+extern uint8_t pop_count_16_ra(uint16_t value) __naked __reg_args;
+
+extern uint8_t ctz_8_ra(uint8_t value) __naked __reg_args;
+extern uint8_t ctz_16_ra(uint16_t value) __naked __reg_args;
+
+extern uint8_t clz_8_ra(uint8_t value) __naked __reg_args;
+extern uint8_t clz_16_ra(uint16_t value) __naked __reg_args;
+
+extern uint8_t ffs_8_ra(uint8_t value) __naked __reg_args;
+extern uint8_t ffs_16_ra(uint16_t value) __naked __reg_args;
+
+extern uint16_t rotate_left_16_ra(uint16_t value, uint8_t count) __naked __reg_args;
+extern uint16_t rotate_right_16_ra(uint16_t value, uint8_t count) __naked __reg_args;
+
+extern uint8_t isqrt_16_ra(uint16_t value) __naked __reg_args;
+
+#endif
 
 /******************************************************************************/
 
@@ -109,6 +261,29 @@ extern int strctcmp(const char *s1, const char *s2) __naked __stack_args;
 
 /******************************************************************************/
 
+// When UTILS_REG_ARGS is defined at build time (and the compiler supports the
+// new ABI), calls to the standard function names are directed to the register
+// argument entry points instead.
+#if defined(UTILS_REG_ARGS) && defined(__reg_args)
+#define swap(x) swap_ra(x)
+#define bswap_16(x) bswap_16_ra(x)
+#define reflect_8(x) reflect_8_ra(x)
+#define reflect_16(x) reflect_16_ra(x)
+#define pop_count_8(x) pop_count_8_ra(x)
+#define pop_count_16(x) pop_count_16_ra(x)
+#define ctz_8(x) ctz_8_ra(x)
+#define ctz_16(x) ctz_16_ra(x)
+#define clz_8(x) clz_8_ra(x)
+#define clz_16(x) clz_16_ra(x)
+#define ffs_8(x) ffs_8_ra(x)
+#define ffs_16(x) ffs_16_ra(x)
+#define rotate_left_16(x, c) rotate_left_16_ra(x, c)
+#define rotate_right_16(x, c) rotate_right_16_ra(x, c)
+#define isqrt_16(x) isqrt_16_ra(x)
+#endif
+
+/******************************************************************************/
+
 // Some function aliases to match names used by some standard libraries or
 // compiler built-ins.
 #define popcount(x) pop_count_16(x)
@@ -122,5 +297,26 @@ extern int strctcmp(const char *s1, const char *s2) __naked __stack_args;
 #define parity(x) parity_even_16(x)
 #define parityl(x) parity_even_32(x)
 #define div(x, y, r) div_s16(x, y, r)
+#define ldiv(x, y, r) div_s32(x, y, r)
+
+// Division by a constant divisor. Where a specialised function exists for the
+// given divisor it is used, otherwise the general-purpose function is. When
+// the divisor is a compile-time constant, the selection is resolved by the
+// compiler, so there is no run-time overhead.
+#define div_u16_const(x, y, r) ( \
+	(y) == 10 ? div_u16_by_10(x, r) : \
+	(y) == 60 ? div_u16_by_60(x, r) : \
+	(y) == 100 ? div_u16_by_100(x, r) : \
+	(y) == 1000 ? div_u16_by_1000(x, r) : \
+	div_u16(x, y, r) \
+)
+#define div_u32_const(x, y, r) ( \
+	(y) == 10 ? div_u32_by_10(x, r) : \
+	(y) == 60 ? div_u32_by_60(x, r) : \
+	(y) == 100 ? div_u32_by_100(x, r) : \
+	(y) == 1000 ? div_u32_by_1000(x, r) : \
+	(y) == 3600 ? div_u32_by_3600(x, r) : \
+	div_u32(x, y, r) \
+)
 
 #endif // UTILS_H_
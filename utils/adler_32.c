@@ -0,0 +1,118 @@
+/*******************************************************************************
+ *
+ * adler_32.c - Adler-32 checksum implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+uint32_t adler_32_update(uint32_t sum, const uint8_t *buf, uint16_t len) __naked __stack_args {
+	(void)sum;
+	(void)buf;
+	(void)len;
+
+	// For return value: 0xAABBCCDD
+	// y = 0xAABB (yh = 0xAA, yl = 0xBB)
+	// x = 0xCCDD (xh = 0xCC, xl = 0xDD)
+
+	__asm
+		; Offsets for arguments.
+		SUM_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		BUF_SP_OFFSET = ASM_ARGS_SP_OFFSET + 4
+		LEN_SP_OFFSET = ASM_ARGS_SP_OFFSET + 6
+
+		; The lower word of the sum arg is the first sum (A), which is kept in
+		; the Y reg, and the upper word is the second sum (B), which is held in
+		; place of the arg.
+		ldw y, (SUM_SP_OFFSET+2, sp)
+
+		; If the length is zero, skip straight to the end, returning the sum
+		; unchanged.
+		ldw x, (LEN_SP_OFFSET, sp)
+		jreq 0005$
+
+		; Calculate the end pointer by adding length to the buffer pointer, and
+		; store it in place of the length arg. Load the buffer pointer into the
+		; X reg. The space of the buffer pointer arg is then used to hold each
+		; data byte zero-extended to 16 bits, so clear its MSB.
+		addw x, (BUF_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw x, (BUF_SP_OFFSET, sp)
+		clr (BUF_SP_OFFSET+0, sp)
+
+	0001$:
+		; Add the next byte from the buffer to A. Rather than reducing modulo
+		; 65521 after every addition, the sums are only kept below 65536, and
+		; reduction is deferred until the end. Because 65536 is congruent to
+		; 15 (modulo 65521), when the addition overflows (i.e. carry is set),
+		; adding 15 gives a result with the same remainder. A is then saved in
+		; place of the lower word of the sum arg.
+		ld a, (x)
+		ld (BUF_SP_OFFSET+1, sp), a
+		addw y, (BUF_SP_OFFSET, sp)
+		jrnc 0002$
+		addw y, #15
+	0002$:
+		ldw (SUM_SP_OFFSET+2, sp), y
+
+		; Add A to B in the same manner. Here, the correction itself may also
+		; overflow, so do the same again if necessary. Then restore A into the
+		; Y reg.
+		addw y, (SUM_SP_OFFSET+0, sp)
+		jrnc 0003$
+		addw y, #15
+		jrnc 0003$
+		addw y, #15
+	0003$:
+		ldw (SUM_SP_OFFSET+0, sp), y
+		ldw y, (SUM_SP_OFFSET+2, sp)
+
+		; Advance the pointer and loop around if not yet at the end.
+		incw x
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+		; Perform the final reduction of A, by subtracting 65521 if it is
+		; not already less than that.
+		cpw y, #65521
+		jrult 0004$
+		subw y, #65521
+	0004$:
+		ldw (SUM_SP_OFFSET+2, sp), y
+
+		; Likewise for B.
+		ldw y, (SUM_SP_OFFSET+0, sp)
+		cpw y, #65521
+		jrult 0005$
+		subw y, #65521
+		ldw (SUM_SP_OFFSET+0, sp), y
+
+	0005$:
+		; Return the sums in the X and Y regs.
+		ldw x, (SUM_SP_OFFSET+2, sp)
+		ldw y, (SUM_SP_OFFSET+0, sp)
+		ASM_RETURN
+	__endasm;
+}
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ *
+ * bcd2bin_16.c - BCD to binary 16-bit conversion implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+uint16_t bcd2bin_16(uint32_t bcd) __naked __stack_args {
+	(void)bcd;
+
+	// For return value: 0xAABB
+	// x = 0xAABB (xh = 0xAA, xl = 0xBB)
+
+	__asm
+		.macro bcd2bin_16_pair offset
+			; Convert the packed BCD byte at the given offset to binary in
+			; place. The value of a packed byte is tens * 16 + ones, so the
+			; binary value (tens * 10 + ones) is obtained by subtracting six
+			; times the tens digit. The tens digit is obtained by swapping it
+			; into the lower nibble.
+			ld a, (BCD_SP_OFFSET+offset, sp)
+			swap a
+			and a, #0x0F
+			ld xl, a
+			ld a, #6
+			mul x, a
+			ld a, xl
+			neg a
+			add a, (BCD_SP_OFFSET+offset, sp)
+			ld (BCD_SP_OFFSET+offset, sp), a
+		.endm
+
+		; Offsets for arguments.
+		BCD_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+
+		; Convert the lower two pairs of digits to binary.
+		bcd2bin_16_pair 2
+		bcd2bin_16_pair 3
+
+		; Multiply the middle pair by 100, then add the lowest pair by zeroing
+		; the byte above it and adding it as a word.
+		ld a, (BCD_SP_OFFSET+2, sp)
+		ld xl, a
+		ld a, #100
+		mul x, a
+		clr (BCD_SP_OFFSET+2, sp)
+		addw x, (BCD_SP_OFFSET+2, sp)
+
+		; Add the most-significant digit multiplied by 10000 (0x2710). This
+		; digit is no more than 9, so the product is formed as a word with
+		; an MSB of digit * 0x27 (of which only the lower 8 bits matter) and
+		; an LSB of digit * 0x10 (i.e. the digit swapped into the upper
+		; nibble), and stored in place of the upper word of the arg.
+		ld a, (BCD_SP_OFFSET+1, sp)
+		and a, #0x0F
+		ld yl, a
+		swap a
+		ld (BCD_SP_OFFSET+1, sp), a
+		ld a, #0x27
+		mul y, a
+		ld a, yl
+		ld (BCD_SP_OFFSET+0, sp), a
+		addw x, (BCD_SP_OFFSET+0, sp)
+		ASM_RETURN
+	__endasm;
+}
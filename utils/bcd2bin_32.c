@@ -0,0 +1,113 @@
+/*******************************************************************************
+ *
+ * bcd2bin_32.c - BCD to binary 32-bit conversion implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+uint32_t bcd2bin_32(const uint8_t *bcd) __naked __stack_args {
+	(void)bcd;
+
+	// For return value: 0xAABBCCDD
+	// y = 0xAABB (yh = 0xAA, yl = 0xBB)
+	// x = 0xCCDD (xh = 0xCC, xl = 0xDD)
+
+	__asm
+		.macro bcd2bin_32_mul_byte offset
+			; Multiply the result byte at the given offset by 100, and add the
+			; carry from the previous (less-significant) byte. The LSB of the
+			; product replaces the result byte, and the MSB becomes the carry
+			; for the next byte.
+			ld a, (RESULT_SP_OFFSET+offset, sp)
+			ld xl, a
+			ld a, #100
+			mul x, a
+			addw x, (CARRY_SP_OFFSET, sp)
+			ld a, xl
+			ld (RESULT_SP_OFFSET+offset, sp), a
+			ld a, xh
+			ld (CARRY_SP_OFFSET+1, sp), a
+		.endm
+
+		; Offsets and sizes for all stack-held variables and arguments.
+		COUNT_SP_OFFSET = 1
+		COUNT_SP_SIZE = 1
+		CARRY_SP_OFFSET = COUNT_SP_OFFSET + COUNT_SP_SIZE
+		CARRY_SP_SIZE = 2
+		RESULT_SP_OFFSET = CARRY_SP_OFFSET + CARRY_SP_SIZE
+		RESULT_SP_SIZE = 4
+		BCD_SP_OFFSET = RESULT_SP_OFFSET + RESULT_SP_SIZE + (ASM_ARGS_SP_OFFSET - 1)
+		BCD_SP_SIZE = 2
+
+		; Allocate the result and carry on the stack, initialised to zero (the
+		; MSB of the carry always stays zero, so that it may be added as a
+		; word). Allocate a counter for the 5 input bytes.
+		clrw x
+		pushw x
+		pushw x
+		pushw x
+		push #5
+
+		; Load the input pointer into the Y reg.
+		ldw y, (BCD_SP_OFFSET, sp)
+
+	0001$:
+		; Convert the next packed BCD byte to binary. The value of a packed
+		; byte is tens * 16 + ones, so the binary value (tens * 10 + ones) is
+		; obtained by subtracting six times the tens digit. The tens digit is
+		; obtained by swapping it into the lower nibble.
+		ld a, (y)
+		swap a
+		and a, #0x0F
+		ld xl, a
+		ld a, #6
+		mul x, a
+		ld a, xl
+		neg a
+		add a, (y)
+
+		; Multiply the result by 100 and add the converted byte, by using it
+		; as the initial carry, one byte at a time from the LSB.
+		ld (CARRY_SP_OFFSET+1, sp), a
+		bcd2bin_32_mul_byte 3
+		bcd2bin_32_mul_byte 2
+		bcd2bin_32_mul_byte 1
+		bcd2bin_32_mul_byte 0
+
+		; Advance the pointer, decrement the counter and loop around if there
+		; are more bytes to do.
+		incw y
+		dec (COUNT_SP_OFFSET, sp)
+		jrne 0001$
+
+		; Load the result into the X and Y regs, and clean up stack-allocated
+		; variables.
+		ldw x, (RESULT_SP_OFFSET+2, sp)
+		ldw y, (RESULT_SP_OFFSET+0, sp)
+		addw sp, #7
+		ASM_RETURN
+	__endasm;
+}
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ *
+ * bin2bcd_16.c - Binary to BCD 16-bit conversion implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+uint32_t bin2bcd_16(uint16_t value) __naked __stack_args {
+	(void)value;
+
+	// For return value: 0xAABBCCDD
+	// y = 0xAABB (yh = 0xAA, yl = 0xBB)
+	// x = 0xCCDD (xh = 0xCC, xl = 0xDD)
+
+	__asm
+		.macro bin2bcd_16_pack offset
+			; Split the remainder (0-99) in the A reg into tens and ones digits
+			; by dividing by 10, then combine them into a packed BCD byte by
+			; swapping the tens digit into the upper nibble and OR-ing in the
+			; ones digit. The byte is stored at the given offset, which also
+			; serves as a temporary for the ones digit.
+			clrw y
+			ld yl, a
+			ld a, #10
+			div y, a
+			ld (VALUE_SP_OFFSET+offset, sp), a
+			ld a, yl
+			swap a
+			or a, (VALUE_SP_OFFSET+offset, sp)
+			ld (VALUE_SP_OFFSET+offset, sp), a
+		.endm
+
+		; Offsets for arguments.
+		VALUE_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+
+		; Load the value arg into the X reg. Divide by 100 to get the lowest
+		; two digits as the remainder, and store them packed in place of the
+		; LSB of the value arg.
+		ldw x, (VALUE_SP_OFFSET, sp)
+		ld a, #100
+		div x, a
+		bin2bcd_16_pack 1
+
+		; Divide by 100 again to get the middle two digits, and store them in
+		; place of the MSB of the value arg.
+		ld a, #100
+		div x, a
+		bin2bcd_16_pack 0
+
+		; The quotient remaining in the X reg is the most-significant digit
+		; (no more than 6), which forms the upper word of the result. The
+		; lower four digits form the lower word.
+		ldw y, x
+		ldw x, (VALUE_SP_OFFSET, sp)
+		ASM_RETURN
+	__endasm;
+}
@@ -0,0 +1,97 @@
+/*******************************************************************************
+ *
+ * bin2bcd_32.c - Binary to BCD 32-bit conversion implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+void bin2bcd_32(uint32_t value, uint8_t *bcd) __naked __stack_args {
+	(void)value;
+	(void)bcd;
+
+	__asm
+		.macro bin2bcd_32_div_byte offset
+			; Move the remainder so far from the LSB to the MSB of the X reg,
+			; load the next byte of the value into the LSB, and divide by 100.
+			; The quotient (which fits in a byte, because the remainder is
+			; less than 100) replaces the value byte, and the new remainder is
+			; left in the LSB of the X reg.
+			ld a, xl
+			ld xh, a
+			ld a, (VALUE_SP_OFFSET+offset, sp)
+			ld xl, a
+			ld a, #100
+			div x, a
+			exg a, xl
+			ld (VALUE_SP_OFFSET+offset, sp), a
+		.endm
+
+		; Offsets and sizes for all stack-held variables and arguments.
+		COUNT_SP_OFFSET = 1
+		COUNT_SP_SIZE = 1
+		VALUE_SP_OFFSET = COUNT_SP_OFFSET + COUNT_SP_SIZE + (ASM_ARGS_SP_OFFSET - 1)
+		VALUE_SP_SIZE = 4
+		BCD_SP_OFFSET = VALUE_SP_OFFSET + VALUE_SP_SIZE
+		BCD_SP_SIZE = 2
+
+		; Allocate a counter on the stack for the 5 output bytes.
+		push #5
+
+		; Load the output pointer into the Y reg, and point it past the end of
+		; the 5 output bytes, as they are produced least-significant first.
+		ldw y, (BCD_SP_OFFSET, sp)
+		addw y, #5
+
+	0001$:
+		; Divide the value (held in place of its arg) by 100, one byte at a
+		; time from the MSB, leaving the remainder in the X reg.
+		clrw x
+		bin2bcd_32_div_byte 0
+		bin2bcd_32_div_byte 1
+		bin2bcd_32_div_byte 2
+		bin2bcd_32_div_byte 3
+
+		; Split the remainder into tens and ones digits by dividing by 10.
+		; Store the ones digit in the next output byte, then swap the tens
+		; digit into the upper nibble and OR it in.
+		ld a, #10
+		div x, a
+		decw y
+		ld (y), a
+		ld a, xl
+		swap a
+		or a, (y)
+		ld (y), a
+
+		; Decrement the counter and loop around if there are more bytes to do.
+		dec (COUNT_SP_OFFSET, sp)
+		jrne 0001$
+
+		; Clean up stack-allocated counter.
+		pop a
+		ASM_RETURN
+	__endasm;
+}
@@ -0,0 +1,84 @@
+/*******************************************************************************
+ *
+ * bitset.c - Bitmap slot allocator implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+// Masks for each bit position within a byte, to avoid variable-count shifts.
+static const uint8_t bitset_masks[8] = {
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80
+};
+
+void bitset_init(bitset_t *set, uint8_t *storage, uint16_t slots) __stack_args {
+	set->bitmap = storage;
+	set->slots = slots;
+	set->len = BITSET_STORAGE_SIZE(slots);
+	set->next = 0;
+
+	// A 1-bit represents a free slot, so that the lowest free slot can be found
+	// directly with ffs_bitmap_next. Set all bits for whole bytes, and only the
+	// bits for the remaining slots in the last byte, so that bits beyond the
+	// slot count are never allocated.
+	for(uint16_t i = 0; i < slots / 8; i++) storage[i] = 0xFF;
+	if(slots % 8) storage[slots / 8] = bitset_masks[slots % 8] - 1;
+}
+
+uint16_t bitset_alloc(bitset_t *set) __stack_args {
+	// All slots below the search start position are known to be allocated, so
+	// only search from there. Typically, the lowest free slot will be found in
+	// the first byte examined.
+	uint16_t index = ffs_bitmap_next(set->bitmap, set->len, set->next);
+
+	// When no free slot was found, move the search start position to the end,
+	// so that further allocation attempts fail immediately until a slot is
+	// freed.
+	if(!index) {
+		set->next = set->slots;
+		return BITSET_NONE;
+	}
+
+	// The result is the index plus one. Mark the slot as allocated, and start
+	// the next search from the slot after it.
+	index--;
+	set->bitmap[index / 8] &= ~bitset_masks[index % 8];
+	set->next = index + 1;
+
+	return index;
+}
+
+void bitset_free(bitset_t *set, uint16_t index) __stack_args {
+	if(index >= set->slots) return;
+
+	// Mark the slot as free. If it is below the search start position, move the
+	// position back to it, so it is the next slot to be allocated.
+	set->bitmap[index / 8] |= bitset_masks[index % 8];
+	if(index < set->next) set->next = index;
+}
+
+uint16_t bitset_count_free(const bitset_t *set) __stack_args {
+	return pop_count_buf(set->bitmap, set->len);
+}
@@ -37,3 +37,17 @@ uint16_t bswap_16(const uint16_t value) __naked __stack_args {
 		ASM_RETURN
 	__endasm;
 }
+
+#if defined(__reg_args)
+
+uint16_t bswap_16_ra(const uint16_t value) __naked __reg_args {
+	(void)value;
+
+	__asm
+		; Value arg is already in X reg.
+		swapw x
+		ASM_RETURN
+	__endasm;
+}
+
+#endif
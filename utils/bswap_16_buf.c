@@ -0,0 +1,68 @@
+/*******************************************************************************
+ *
+ * bswap_16_buf.c - 16-bit buffer in-place byte-swap implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+void bswap_16_buf(uint16_t *buf, uint16_t count) __naked __stack_args {
+	(void)buf;
+	(void)count;
+
+	__asm
+		; Offsets for arguments.
+		BUF_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		COUNT_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+
+		; Load count arg into X reg. If it is zero, there is nothing to do, so
+		; quit straight away. Otherwise, multiply by the element size and add
+		; the buffer pointer to get the end pointer, which is stored in place of
+		; the count arg. Load the buffer pointer into the X reg.
+		ldw x, (COUNT_SP_OFFSET, sp)
+		jreq 0002$
+		sllw x
+		addw x, (BUF_SP_OFFSET, sp)
+		ldw (COUNT_SP_OFFSET, sp), x
+		ldw x, (BUF_SP_OFFSET, sp)
+
+	0001$:
+		; Load the element into the Y reg, via a copy of the pointer, swap its
+		; bytes, and store it back. Advance the pointer to the next element.
+		ldw y, x
+		ldw y, (y)
+		swapw y
+		ldw (x), y
+		incw x
+		incw x
+
+		; Loop around if not yet at the end.
+		cpw x, (COUNT_SP_OFFSET, sp)
+		jrne 0001$
+
+	0002$:
+		ASM_RETURN
+	__endasm;
+}
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ *
+ * bswap_16_buf_copy.c - 16-bit buffer copying byte-swap implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+void bswap_16_buf_copy(uint16_t *dst, const uint16_t *src, uint16_t count) __naked __stack_args {
+	(void)dst;
+	(void)src;
+	(void)count;
+
+	__asm
+		; Offsets for arguments.
+		DST_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		SRC_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+		COUNT_SP_OFFSET = ASM_ARGS_SP_OFFSET + 4
+
+		; Load count arg into X reg. If it is zero, there is nothing to do, so
+		; quit straight away. Otherwise, multiply by the element size and add
+		; the source pointer to get the end pointer, which is stored in place of
+		; the count arg. Load the source pointer into the X reg and destination
+		; pointer into the Y reg.
+		ldw x, (COUNT_SP_OFFSET, sp)
+		jreq 0002$
+		sllw x
+		addw x, (SRC_SP_OFFSET, sp)
+		ldw (COUNT_SP_OFFSET, sp), x
+		ldw x, (SRC_SP_OFFSET, sp)
+		ldw y, (DST_SP_OFFSET, sp)
+
+	0001$:
+		; Copy each byte of the source element to the opposite position in the
+		; destination element. Advance both pointers to the next element.
+		ld a, (x)
+		ld (1, y), a
+		ld a, (1, x)
+		ld (y), a
+		incw x
+		incw x
+		incw y
+		incw y
+
+		; Loop around if not yet at the end of the source.
+		cpw x, (COUNT_SP_OFFSET, sp)
+		jrne 0001$
+
+	0002$:
+		ASM_RETURN
+	__endasm;
+}
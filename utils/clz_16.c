@@ -92,3 +92,74 @@ uint8_t clz_16(uint16_t value) __naked __stack_args {
 
 #endif
 }
+
+#if defined(__reg_args)
+
+uint8_t clz_16_ra(uint16_t value) __naked __reg_args {
+	(void)value;
+
+#if defined(CLZ_LUT_LARGE)
+
+	__asm
+		; Value arg is already in X reg, so use Y reg for table index instead.
+		; Initialise Y reg to zero. This ensures the MSB of table index is zero,
+		; but also initialises count to zero, because the LSB is swapped in to
+		; the count.
+		clrw y
+
+		; Load MSB of value arg into A reg. Check if most-significant bit is
+		; set, and quit if so. Otherwise, look up the zero count from the table
+		; at offset determined by value byte in Y reg, and add it to count.
+		ld a, xh
+		tnz a
+		exg a, yl
+		jrmi 0001$
+		add a, (_clz_lut_large, y)
+
+		; If the count is now anything less than 8 (i.e. last byte was not all
+		; zeroes), then quit.
+		cp a, #8
+		jrne 0001$
+
+		; Swap the count from A into LSB of Y reg for safe-keeping.
+		exg a, yl
+
+		; Do the same table look-up as before, but with LSB of value arg.
+		ld a, xl
+		tnz a
+		exg a, yl
+		jrmi 0001$
+		add a, (_clz_lut_large, y)
+
+	0001$:
+		; Return with the count in the A reg.
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		; Value arg is already in X reg. Initialise count in A reg to zero.
+		clr a
+
+		; Set the carry flag, so that even if value arg is all zeroes, we will
+		; always encounter a one after counting all 16 zero bits.
+		scf
+
+	0001$:
+		; Shift the value left one bit. If the carry (i.e. bit shifted off) is
+		; a one, then exit, otherwise increment the count and loop around.
+		rlcw x
+		jrc 0002$
+		inc a
+		jra 0001$
+
+	0002$:
+		; Return with the count in the A reg.
+		ASM_RETURN
+	__endasm;
+
+#endif
+}
+
+#endif
@@ -79,3 +79,58 @@ uint8_t clz_8(uint8_t value) __naked __stack_args {
 
 #endif
 }
+
+#if defined(__reg_args)
+
+uint8_t clz_8_ra(uint8_t value) __naked __reg_args {
+	(void)value;
+
+#if defined(CLZ_LUT_LARGE)
+
+	__asm
+		; Initialise X reg to zero. This ensures the MSB of table index is zero,
+		; but also initialises count to zero, because the LSB is swapped in to
+		; the count.
+		clrw x
+
+		; Value arg is already in A reg. Check if most-significant bit is set,
+		; and quit if so. Otherwise, look up the zero count from the table at
+		; offset determined by value byte in X reg, and add it to count.
+		tnz a
+		exg a, xl
+		jrmi 0001$
+		add a, (_clz_lut_large, x)
+
+	0001$:
+		; Return with the count in the A reg.
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		; Value arg is already in A reg. Initialise count in X reg to zero.
+		clrw x
+
+		; Set the carry flag, so that even if value arg is all zeroes, we will
+		; always encounter a one after counting all 8 zero bits.
+		scf
+
+	0001$:
+		; Shift the value left one bit. If the carry (i.e. bit shifted off) is
+		; a one, then exit, otherwise increment the count and loop around.
+		rlc a
+		jrc 0002$
+		incw x
+		jra 0001$
+
+	0002$:
+		; Copy the count to the A reg for return value.
+		ld a, xl
+		ASM_RETURN
+	__endasm;
+
+#endif
+}
+
+#endif
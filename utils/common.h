@@ -29,6 +29,10 @@
 
 #include <stdint.h>
 
+// The library itself must always define the real function names, so never
+// redirect them to the register argument entry points here.
+#undef UTILS_REG_ARGS
+
 #ifdef __SDCC_MODEL_LARGE
 #define ASM_ARGS_SP_OFFSET 4
 #define ASM_RETURN retf
@@ -41,6 +45,10 @@
 extern const uint8_t reflect_lut[16];
 #endif
 
+#if defined(REFLECT_LUT_LARGE)
+extern const uint8_t reflect_lut_large[256];
+#endif
+
 #if defined(POP_COUNT_LUT_LARGE)
 extern const uint8_t pop_count_lut_large[128];
 #elif defined(POP_COUNT_LUT_SMALL)
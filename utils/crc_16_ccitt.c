@@ -0,0 +1,271 @@
+/*******************************************************************************
+ *
+ * crc_16_ccitt.c - CRC-16/CCITT implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+#if defined(CRC_LUT_LARGE)
+
+// CRC-16/CCITT 'large' (2 x 256 bytes) look-up table.
+// Values are the CRC (polynomial 0x1021) of each distinct byte value in the
+// upper 8 bits, split into separate tables of MSB and LSB.
+const uint8_t crc_16_ccitt_lut_large[2][256] = {
+	{
+		0x00,0x10,0x20,0x30,0x40,0x50,0x60,0x70,0x81,0x91,0xA1,0xB1,0xC1,0xD1,0xE1,0xF1,
+		0x12,0x02,0x32,0x22,0x52,0x42,0x72,0x62,0x93,0x83,0xB3,0xA3,0xD3,0xC3,0xF3,0xE3,
+		0x24,0x34,0x04,0x14,0x64,0x74,0x44,0x54,0xA5,0xB5,0x85,0x95,0xE5,0xF5,0xC5,0xD5,
+		0x36,0x26,0x16,0x06,0x76,0x66,0x56,0x46,0xB7,0xA7,0x97,0x87,0xF7,0xE7,0xD7,0xC7,
+		0x48,0x58,0x68,0x78,0x08,0x18,0x28,0x38,0xC9,0xD9,0xE9,0xF9,0x89,0x99,0xA9,0xB9,
+		0x5A,0x4A,0x7A,0x6A,0x1A,0x0A,0x3A,0x2A,0xDB,0xCB,0xFB,0xEB,0x9B,0x8B,0xBB,0xAB,
+		0x6C,0x7C,0x4C,0x5C,0x2C,0x3C,0x0C,0x1C,0xED,0xFD,0xCD,0xDD,0xAD,0xBD,0x8D,0x9D,
+		0x7E,0x6E,0x5E,0x4E,0x3E,0x2E,0x1E,0x0E,0xFF,0xEF,0xDF,0xCF,0xBF,0xAF,0x9F,0x8F,
+		0x91,0x81,0xB1,0xA1,0xD1,0xC1,0xF1,0xE1,0x10,0x00,0x30,0x20,0x50,0x40,0x70,0x60,
+		0x83,0x93,0xA3,0xB3,0xC3,0xD3,0xE3,0xF3,0x02,0x12,0x22,0x32,0x42,0x52,0x62,0x72,
+		0xB5,0xA5,0x95,0x85,0xF5,0xE5,0xD5,0xC5,0x34,0x24,0x14,0x04,0x74,0x64,0x54,0x44,
+		0xA7,0xB7,0x87,0x97,0xE7,0xF7,0xC7,0xD7,0x26,0x36,0x06,0x16,0x66,0x76,0x46,0x56,
+		0xD9,0xC9,0xF9,0xE9,0x99,0x89,0xB9,0xA9,0x58,0x48,0x78,0x68,0x18,0x08,0x38,0x28,
+		0xCB,0xDB,0xEB,0xFB,0x8B,0x9B,0xAB,0xBB,0x4A,0x5A,0x6A,0x7A,0x0A,0x1A,0x2A,0x3A,
+		0xFD,0xED,0xDD,0xCD,0xBD,0xAD,0x9D,0x8D,0x7C,0x6C,0x5C,0x4C,0x3C,0x2C,0x1C,0x0C,
+		0xEF,0xFF,0xCF,0xDF,0xAF,0xBF,0x8F,0x9F,0x6E,0x7E,0x4E,0x5E,0x2E,0x3E,0x0E,0x1E,
+	},
+	{
+		0x00,0x21,0x42,0x63,0x84,0xA5,0xC6,0xE7,0x08,0x29,0x4A,0x6B,0x8C,0xAD,0xCE,0xEF,
+		0x31,0x10,0x73,0x52,0xB5,0x94,0xF7,0xD6,0x39,0x18,0x7B,0x5A,0xBD,0x9C,0xFF,0xDE,
+		0x62,0x43,0x20,0x01,0xE6,0xC7,0xA4,0x85,0x6A,0x4B,0x28,0x09,0xEE,0xCF,0xAC,0x8D,
+		0x53,0x72,0x11,0x30,0xD7,0xF6,0x95,0xB4,0x5B,0x7A,0x19,0x38,0xDF,0xFE,0x9D,0xBC,
+		0xC4,0xE5,0x86,0xA7,0x40,0x61,0x02,0x23,0xCC,0xED,0x8E,0xAF,0x48,0x69,0x0A,0x2B,
+		0xF5,0xD4,0xB7,0x96,0x71,0x50,0x33,0x12,0xFD,0xDC,0xBF,0x9E,0x79,0x58,0x3B,0x1A,
+		0xA6,0x87,0xE4,0xC5,0x22,0x03,0x60,0x41,0xAE,0x8F,0xEC,0xCD,0x2A,0x0B,0x68,0x49,
+		0x97,0xB6,0xD5,0xF4,0x13,0x32,0x51,0x70,0x9F,0xBE,0xDD,0xFC,0x1B,0x3A,0x59,0x78,
+		0x88,0xA9,0xCA,0xEB,0x0C,0x2D,0x4E,0x6F,0x80,0xA1,0xC2,0xE3,0x04,0x25,0x46,0x67,
+		0xB9,0x98,0xFB,0xDA,0x3D,0x1C,0x7F,0x5E,0xB1,0x90,0xF3,0xD2,0x35,0x14,0x77,0x56,
+		0xEA,0xCB,0xA8,0x89,0x6E,0x4F,0x2C,0x0D,0xE2,0xC3,0xA0,0x81,0x66,0x47,0x24,0x05,
+		0xDB,0xFA,0x99,0xB8,0x5F,0x7E,0x1D,0x3C,0xD3,0xF2,0x91,0xB0,0x57,0x76,0x15,0x34,
+		0x4C,0x6D,0x0E,0x2F,0xC8,0xE9,0x8A,0xAB,0x44,0x65,0x06,0x27,0xC0,0xE1,0x82,0xA3,
+		0x7D,0x5C,0x3F,0x1E,0xF9,0xD8,0xBB,0x9A,0x75,0x54,0x37,0x16,0xF1,0xD0,0xB3,0x92,
+		0x2E,0x0F,0x6C,0x4D,0xAA,0x8B,0xE8,0xC9,0x26,0x07,0x64,0x45,0xA2,0x83,0xE0,0xC1,
+		0x1F,0x3E,0x5D,0x7C,0x9B,0xBA,0xD9,0xF8,0x17,0x36,0x55,0x74,0x93,0xB2,0xD1,0xF0,
+	},
+};
+
+#elif defined(CRC_LUT_SMALL)
+
+// CRC-16/CCITT 'small' (2 x 16 bytes) look-up table.
+// Values are the CRC (polynomial 0x1021) of each distinct nibble value in the
+// upper 4 bits, split into separate tables of MSB and LSB.
+const uint8_t crc_16_ccitt_lut_small[2][16] = {
+	{
+		0x00,0x10,0x20,0x30,0x40,0x50,0x60,0x70,0x81,0x91,0xA1,0xB1,0xC1,0xD1,0xE1,0xF1,
+	},
+	{
+		0x00,0x21,0x42,0x63,0x84,0xA5,0xC6,0xE7,0x08,0x29,0x4A,0x6B,0x8C,0xAD,0xCE,0xEF,
+	},
+};
+
+#endif
+
+uint16_t crc_16_ccitt_update(uint16_t crc, const uint8_t *buf, uint16_t len) __naked __stack_args {
+	(void)crc;
+	(void)buf;
+	(void)len;
+
+	// For return value: 0xAABB
+	// x = 0xAABB (xh = 0xAA, xl = 0xBB)
+
+#if defined(CRC_LUT_LARGE)
+
+	__asm
+		; Offsets for arguments.
+		CRC_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		BUF_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+		LEN_SP_OFFSET = ASM_ARGS_SP_OFFSET + 4
+
+		; If the length is zero, quit straight away, returning the CRC
+		; unchanged.
+		ldw x, (LEN_SP_OFFSET, sp)
+		jreq 0002$
+
+		; Calculate the end pointer by adding length to the buffer pointer, and
+		; store it in place of the length arg. Load the buffer pointer into the
+		; X reg.
+		addw x, (BUF_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw x, (BUF_SP_OFFSET, sp)
+
+		; Initialise Y reg to zero, so MSB of table index is always zero.
+		clrw y
+
+	0001$:
+		; XOR the next byte from the buffer with the CRC MSB to give the table
+		; index. The new CRC MSB is the old LSB XOR-ed with the table MSB, and
+		; the new LSB is the table LSB. The CRC is held in place of its arg.
+		ld a, (x)
+		xor a, (CRC_SP_OFFSET+0, sp)
+		ld yl, a
+		ld a, (CRC_SP_OFFSET+1, sp)
+		xor a, (_crc_16_ccitt_lut_large+0, y)
+		ld (CRC_SP_OFFSET+0, sp), a
+		ld a, (_crc_16_ccitt_lut_large+256, y)
+		ld (CRC_SP_OFFSET+1, sp), a
+
+		; Advance the pointer and loop around if not yet at the end.
+		incw x
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+	0002$:
+		; Return the CRC in the X reg.
+		ldw x, (CRC_SP_OFFSET, sp)
+		ASM_RETURN
+	__endasm;
+
+#elif defined(CRC_LUT_SMALL)
+
+	__asm
+		.macro crc_16_ccitt_nibble
+			; Take the upper nibble of the CRC as the table index in the X reg,
+			; then shift the CRC left by 4 bits and XOR in the table values.
+			ld a, yh
+			swap a
+			and a, #0x0F
+			ld xl, a
+			sllw y
+			sllw y
+			sllw y
+			sllw y
+			ld a, yh
+			xor a, (_crc_16_ccitt_lut_small+0, x)
+			ld yh, a
+			ld a, yl
+			xor a, (_crc_16_ccitt_lut_small+16, x)
+			ld yl, a
+		.endm
+
+		; Offsets for arguments.
+		CRC_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		BUF_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+		LEN_SP_OFFSET = ASM_ARGS_SP_OFFSET + 4
+
+		; Load the CRC arg into the Y reg. If the length is zero, quit straight
+		; away, returning the CRC unchanged.
+		ldw y, (CRC_SP_OFFSET, sp)
+		ldw x, (LEN_SP_OFFSET, sp)
+		jreq 0002$
+
+		; Calculate the end pointer by adding length to the buffer pointer, and
+		; store it in place of the length arg. Load the buffer pointer into the
+		; X reg.
+		addw x, (BUF_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw x, (BUF_SP_OFFSET, sp)
+
+	0001$:
+		; XOR the next byte from the buffer into the CRC MSB.
+		ld a, yh
+		xor a, (x)
+		ld yh, a
+
+		; Save the pointer, and clear the X reg for use as the table index,
+		; so its MSB is always zero. Then update the CRC one nibble at a time,
+		; upper nibble first.
+		pushw x
+		clrw x
+		crc_16_ccitt_nibble
+		crc_16_ccitt_nibble
+		popw x
+
+		; Advance the pointer and loop around if not yet at the end.
+		incw x
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+	0002$:
+		; Return the CRC in the X reg.
+		ldw x, y
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		; Offsets for arguments.
+		CRC_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		BUF_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+		LEN_SP_OFFSET = ASM_ARGS_SP_OFFSET + 4
+
+		; Load the CRC arg into the Y reg. If the length is zero, quit straight
+		; away, returning the CRC unchanged.
+		ldw y, (CRC_SP_OFFSET, sp)
+		ldw x, (LEN_SP_OFFSET, sp)
+		jreq 0004$
+
+		; Calculate the end pointer by adding length to the buffer pointer, and
+		; store it in place of the length arg. Load the buffer pointer into the
+		; X reg.
+		addw x, (BUF_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw x, (BUF_SP_OFFSET, sp)
+
+	0001$:
+		; XOR the next byte from the buffer into the CRC MSB, and allocate a
+		; counter for the 8 bits on the stack.
+		ld a, yh
+		xor a, (x)
+		ld yh, a
+		push #8
+
+	0002$:
+		; Shift the CRC left one bit. If the bit shifted off (i.e. the carry)
+		; is a one, XOR the CRC with the polynomial.
+		sllw y
+		jrnc 0003$
+		ld a, yh
+		xor a, #0x10
+		ld yh, a
+		ld a, yl
+		xor a, #0x21
+		ld yl, a
+
+	0003$:
+		; Decrement the counter and loop around if there are more bits to do.
+		dec (1, sp)
+		jrne 0002$
+		pop a
+
+		; Advance the pointer and loop around if not yet at the end.
+		incw x
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+	0004$:
+		; Return the CRC in the X reg.
+		ldw x, y
+		ASM_RETURN
+	__endasm;
+
+#endif
+}
@@ -96,3 +96,75 @@ uint8_t ctz_16(uint16_t value) __naked __stack_args {
 
 #endif
 }
+
+#if defined(__reg_args)
+
+uint8_t ctz_16_ra(uint16_t value) __naked __reg_args {
+	(void)value;
+
+#if defined(CTZ_LUT_LARGE)
+
+	__asm
+		; Value arg is already in X reg, so use Y reg for table index instead.
+		; Initialise Y reg to zero. This ensures the MSB of table index is zero,
+		; but also initialises count to zero, because the LSB is swapped in to
+		; the count.
+		clrw y
+
+		; Load LSB of value arg into A reg. Shift off least-significant bit into
+		; carry. Quit if the carry is 1. Look up the zero count for now 7-bit
+		; value from the table at offset determined by value byte in Y reg, and
+		; add it to count.
+		ld a, xl
+		srl a
+		exg a, yl
+		jrc 0001$
+		add a, (_ctz_lut_large, y)
+
+		; If the count is now anything less than 8 (i.e. last byte was not all
+		; zeroes), then quit.
+		cp a, #8
+		jrne 0001$
+
+		; Swap the count from A into LSB of Y reg for safe-keeping.
+		exg a, yl
+
+		; Do the same table look-up as before, but with MSB of value arg.
+		ld a, xh
+		srl a
+		exg a, yl
+		jrc 0001$
+		add a, (_ctz_lut_large, y)
+
+	0001$:
+		; Return with the count in the A reg.
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		; Value arg is already in X reg. Initialise count in A reg to zero.
+		clr a
+
+		; Set the carry flag, so that even if value arg is all zeroes, we will
+		; always encounter a one after counting all 16 zero bits.
+		scf
+
+	0001$:
+		; Shift the value right one bit. If the carry (i.e. bit shifted off) is
+		; a one, then exit, otherwise increment the count and loop around.
+		rrcw x
+		jrc 0002$
+		inc a
+		jra 0001$
+
+	0002$:
+		; Return with the count in the A reg.
+		ASM_RETURN
+	__endasm;
+
+#endif
+}
+
+#endif
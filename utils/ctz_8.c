@@ -82,3 +82,59 @@ uint8_t ctz_8(uint8_t value) __naked __stack_args {
 
 #endif
 }
+
+#if defined(__reg_args)
+
+uint8_t ctz_8_ra(uint8_t value) __naked __reg_args {
+	(void)value;
+
+#if defined(CTZ_LUT_LARGE)
+
+	__asm
+		; Initialise X reg to zero. This ensures the MSB of table index is zero,
+		; but also initialises count to zero, because the LSB is swapped in to
+		; the count.
+		clrw x
+
+		; Value arg is already in A reg. Shift off least-significant bit into
+		; carry. Quit if the carry is 1. Look up the zero count for now 7-bit
+		; value from the table at offset determined by value byte in X reg, and
+		; add it to count.
+		srl a
+		exg a, xl
+		jrc 0001$
+		add a, (_ctz_lut_large, x)
+
+	0001$:
+		; Return with the count in the A reg.
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		; Value arg is already in A reg. Initialise count in X reg to zero.
+		clrw x
+
+		; Set the carry flag, so that even if value arg is all zeroes, we will
+		; always encounter a one after counting all 8 zero bits.
+		scf
+
+	0001$:
+		; Shift the value right one bit. If the carry (i.e. bit shifted off) is
+		; a one, then exit, otherwise increment the count and loop around.
+		rrc a
+		jrc 0002$
+		incw x
+		jra 0001$
+
+	0002$:
+		; Copy the count to the A reg for return value.
+		ld a, xl
+		ASM_RETURN
+	__endasm;
+
+#endif
+}
+
+#endif
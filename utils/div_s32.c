@@ -0,0 +1,43 @@
+/*******************************************************************************
+ *
+ * div_s32.c - 32-bit simultaneous quotient and remainder signed division
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+void div_s32(int32_t x, int32_t y, div_s32_t *result) __stack_args {
+	// Divide the magnitudes of the arguments with the unsigned division, whose
+	// result struct has the same layout. Negating as unsigned avoids overflow
+	// with a value of INT32_MIN.
+	div_u32((x < 0 ? -(uint32_t)x : x), (y < 0 ? -(uint32_t)y : y), (div_u32_t *)result);
+
+	// If either of the argument values were originally negative, but not both,
+	// then the quotient needs negating. The remainder takes the sign of the
+	// dividend (i.e. the quotient is truncated towards zero).
+	if((x < 0) != (y < 0)) result->quot = -result->quot;
+	if(x < 0) result->rem = -result->rem;
+}
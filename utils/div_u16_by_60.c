@@ -0,0 +1,52 @@
+/*******************************************************************************
+ *
+ * div_u16_by_60.c - 16-bit unsigned division by constant 60 implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+void div_u16_by_60(uint16_t x, div_u16_t *result) __naked __stack_args {
+	(void)x;
+	(void)result;
+
+	__asm
+		; Load x argument dividend and do the division. Quotient is left in X
+		; and remainder in A.
+		ldw x, (ASM_ARGS_SP_OFFSET+0, sp)
+		ld a, #60
+		div x, a
+
+		; Copy the quotient and remainder values into output struct via the
+		; given pointer.
+		ldw y, (ASM_ARGS_SP_OFFSET+2, sp)
+		ldw (y), x
+		clrw x
+		ld xl, a
+		ldw (2, y), x
+
+		ASM_RETURN
+	__endasm;
+}
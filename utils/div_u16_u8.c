@@ -0,0 +1,53 @@
+/*******************************************************************************
+ *
+ * div_u16_u8.c - 16-bit by 8-bit simultaneous quotient and remainder unsigned
+ *                division implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+void div_u16_u8(uint16_t x, uint8_t y, div_u16_u8_t *result) __naked __stack_args {
+	(void)x;
+	(void)y;
+	(void)result;
+
+	__asm
+		; Load x argument dividend and y argument divisor.
+		ldw x, (ASM_ARGS_SP_OFFSET+0, sp)
+		ld a, (ASM_ARGS_SP_OFFSET+2, sp)
+
+		; Do the division. Quotient is left in X and remainder in A.
+		div x, a
+
+		; Copy the quotient and remainder values into output struct via the
+		; given pointer.
+		ldw y, (ASM_ARGS_SP_OFFSET+3, sp)
+		ldw (y), x
+		ld (2, y), a
+
+		ASM_RETURN
+	__endasm;
+}
@@ -38,15 +38,162 @@ void div_u32(uint32_t x, uint32_t y, div_u32_t *result) __naked __stack_args {
 		; Offsets and sizes for all stack-held variables and arguments.
 		COUNTER_SP_OFFSET = 1
 		COUNTER_SP_SIZE = 1
+#ifdef DIV_SKIP_LEADING_ZEROS
+		QUOTIENT_SP_OFFSET = COUNTER_SP_OFFSET + COUNTER_SP_SIZE
+		QUOTIENT_SP_SIZE = 2
+		DIVIDEND_SP_OFFSET = QUOTIENT_SP_OFFSET + QUOTIENT_SP_SIZE + (ASM_ARGS_SP_OFFSET - 1)
+#else
 		REMAINDER_SP_OFFSET = COUNTER_SP_OFFSET + COUNTER_SP_SIZE
 		REMAINDER_SP_SIZE = 4
 		DIVIDEND_SP_OFFSET = REMAINDER_SP_OFFSET + REMAINDER_SP_SIZE + (ASM_ARGS_SP_OFFSET - 1)
+#endif
 		DIVIDEND_SP_SIZE = 4
 		DIVISOR_SP_OFFSET = DIVIDEND_SP_OFFSET + DIVIDEND_SP_SIZE
 		DIVISOR_SP_SIZE = 4
 		RESULT_SP_OFFSET = DIVISOR_SP_OFFSET + DIVISOR_SP_SIZE
 		RESULT_SP_SIZE = 2
 
+		; Offsets for arguments when no stack variables have been allocated.
+		ARG_DIVIDEND_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		ARG_DIVISOR_SP_OFFSET = ARG_DIVIDEND_SP_OFFSET + DIVIDEND_SP_SIZE
+		ARG_RESULT_SP_OFFSET = ARG_DIVISOR_SP_OFFSET + DIVISOR_SP_SIZE
+
+		; If the divisor is less than 0x10000 (i.e. the high word is zero), use
+		; hardware division instead of binary long division.
+		ldw x, (ARG_DIVISOR_SP_OFFSET+0, sp)
+		jreq 0012$
+
+#ifdef DIV_SKIP_LEADING_ZEROS
+
+		; If the dividend is less than the divisor, the quotient is zero and
+		; the remainder is the dividend, so skip straight to the end.
+		ldw x, (ARG_DIVIDEND_SP_OFFSET+2, sp)
+		cpw x, (ARG_DIVISOR_SP_OFFSET+2, sp)
+		ld a, (ARG_DIVIDEND_SP_OFFSET+1, sp)
+		sbc a, (ARG_DIVISOR_SP_OFFSET+1, sp)
+		ld a, (ARG_DIVIDEND_SP_OFFSET+0, sp)
+		sbc a, (ARG_DIVISOR_SP_OFFSET+0, sp)
+		jrult 0009$
+
+		; Count the difference between the number of leading zero bits of the
+		; divisor and of the dividend. Because both are at least 0x10000 here,
+		; only their high words need to be considered. First count up the
+		; leading zeroes of the divisor, then count down those of the dividend.
+		ldw x, (ARG_DIVISOR_SP_OFFSET+0, sp)
+		clr a
+	0001$:
+		sllw x
+		jrc 0002$
+		inc a
+		jra 0001$
+	0002$:
+		ldw x, (ARG_DIVIDEND_SP_OFFSET+0, sp)
+	0003$:
+		sllw x
+		jrc 0004$
+		dec a
+		jra 0003$
+	0004$:
+		; Initialise quotient variable on stack to zero. The quotient can be no
+		; more than 16 bits, because the divisor is at least 0x10000.
+		clrw x
+		pushw x
+
+		; Initialise loop counter on stack to the difference plus one. This is
+		; the number of significant quotient bits that need calculating.
+		inc a
+		push a
+		dec a
+
+		; Left shift the divisor stack arg value in place by the difference, so
+		; that its MSb is aligned with that of the dividend. If the difference
+		; is zero, skip this.
+		jreq 0006$
+	0005$:
+		sll (DIVISOR_SP_OFFSET+3, sp)
+		rlc (DIVISOR_SP_OFFSET+2, sp)
+		rlc (DIVISOR_SP_OFFSET+1, sp)
+		rlc (DIVISOR_SP_OFFSET+0, sp)
+		dec a
+		jrne 0005$
+
+	0006$:
+		; Load the dividend into registers; this will become the remainder.
+		ldw y, (DIVIDEND_SP_OFFSET+0, sp)
+		ldw x, (DIVIDEND_SP_OFFSET+2, sp)
+
+	0007$:
+		; Left shift the quotient by one.
+		sll (QUOTIENT_SP_OFFSET+1, sp)
+		rlc (QUOTIENT_SP_OFFSET+0, sp)
+
+		; Compare remainder value (in X&Y) with shifted divisor value. If
+		; remainder >= divisor (or divisor < remainder), carry on, otherwise
+		; skip ahead.
+		cpw x, (DIVISOR_SP_OFFSET+2, sp) ; carry set if divisor > remainder
+		ld a, yl
+		sbc a, (DIVISOR_SP_OFFSET+1, sp)
+		ld a, yh
+		sbc a, (DIVISOR_SP_OFFSET+0, sp)
+		jrult 0008$
+
+		; Subtract shifted divisor from remainder.
+		subw x, (DIVISOR_SP_OFFSET+2, sp)
+		rrwa y
+		sbc a, (DIVISOR_SP_OFFSET+1, sp)
+		rrwa y
+		sbc a, (DIVISOR_SP_OFFSET+0, sp)
+		rrwa y
+
+		; Set LSb of quotient (INC is fine, as it was just shifted in as zero).
+		inc (QUOTIENT_SP_OFFSET+1, sp)
+
+	0008$:
+		; Right shift the divisor by one.
+		srl (DIVISOR_SP_OFFSET+0, sp)
+		rrc (DIVISOR_SP_OFFSET+1, sp)
+		rrc (DIVISOR_SP_OFFSET+2, sp)
+		rrc (DIVISOR_SP_OFFSET+3, sp)
+
+		; Decrement counter and loop if not yet zero.
+		dec (COUNTER_SP_OFFSET, sp)
+		jrne 0007$
+
+		; Temporarily store remainder in place of dividend stack arg, then copy
+		; quotient and remainder values to result struct. The high word of the
+		; quotient is always zero.
+		ldw (DIVIDEND_SP_OFFSET+0, sp), y
+		ldw (DIVIDEND_SP_OFFSET+2, sp), x
+		ldw x, (RESULT_SP_OFFSET, sp)
+		ldw y, (DIVIDEND_SP_OFFSET+0, sp)
+		ldw (4, x), y
+		ldw y, (DIVIDEND_SP_OFFSET+2, sp)
+		ldw (6, x), y
+		ldw y, (QUOTIENT_SP_OFFSET, sp)
+		ldw (2, x), y
+		clrw y
+		ldw (x), y
+
+		; Unwind stack pointer for local variables.
+		addw sp, #(COUNTER_SP_SIZE + QUOTIENT_SP_SIZE)
+
+		ASM_RETURN
+
+	0009$:
+		; Quotient is zero and remainder is the dividend.
+		ldw x, (ARG_RESULT_SP_OFFSET, sp)
+		ldw y, (ARG_DIVIDEND_SP_OFFSET+0, sp)
+		ldw (4, x), y
+		ldw y, (ARG_DIVIDEND_SP_OFFSET+2, sp)
+		ldw (6, x), y
+		clrw y
+		ldw (x), y
+		ldw (2, x), y
+
+		ASM_RETURN
+
+#else
+
 		; Initialise remainder variable on stack to zero.
 		clrw x
 		pushw x
@@ -55,7 +202,7 @@ void div_u32(uint32_t x, uint32_t y, div_u32_t *result) __naked __stack_args {
 		; Initialise loop counter on stack.
 		push #32
 
-	0001$:
+	0010$:
 		; Left shift by one the dividend stack arg value in place, getting the
 		; MSb in carry.
 		sll (DIVIDEND_SP_OFFSET+3, sp)
@@ -80,7 +227,7 @@ void div_u32(uint32_t x, uint32_t y, div_u32_t *result) __naked __stack_args {
 		sbc a, (DIVISOR_SP_OFFSET+1, sp)
 		ld a, yh
 		sbc a, (DIVISOR_SP_OFFSET+0, sp)
-		jrult 0002$
+		jrult 0011$
 
 		; Subtract divisor from remainder.
 		subw x, (DIVISOR_SP_OFFSET+2, sp)
@@ -95,14 +242,14 @@ void div_u32(uint32_t x, uint32_t y, div_u32_t *result) __naked __stack_args {
 		or a, #1
 		ld (DIVIDEND_SP_OFFSET+3, sp), a
 
-	0002$:
+	0011$:
 		; Store remainder value from registers back into stack variable.
 		ldw (REMAINDER_SP_OFFSET+0, sp), y
 		ldw (REMAINDER_SP_OFFSET+2, sp), x
 
 		; Decrement counter and loop if not yet zero.
 		dec (COUNTER_SP_OFFSET, sp)
-		jrne 0001$
+		jrne 0010$
 
 		; Copy quotient and remainder values to result struct.
 		ldw x, (RESULT_SP_OFFSET, sp)
@@ -118,6 +265,112 @@ void div_u32(uint32_t x, uint32_t y, div_u32_t *result) __naked __stack_args {
 		; Unwind stack pointer for local variables.
 		addw sp, #(COUNTER_SP_SIZE + REMAINDER_SP_SIZE)
 
+		ASM_RETURN
+
+#endif
+
+	0012$:
+		; Divide the high word of the dividend by the divisor. The quotient is
+		; the high word of the final quotient, so store it back in place of the
+		; dividend arg. The remainder (in Y) is less than the divisor, so the
+		; quotient of the remainder and low word combined will fit in 16 bits.
+		ldw x, (ARG_DIVIDEND_SP_OFFSET+0, sp)
+		ldw y, (ARG_DIVISOR_SP_OFFSET+2, sp)
+		divw x, y
+		ldw (ARG_DIVIDEND_SP_OFFSET+0, sp), x
+		ldw x, (ARG_DIVIDEND_SP_OFFSET+2, sp)
+
+		; If the remainder is zero (always the case when the dividend is less
+		; than 0x10000), the low word can simply be divided by the divisor with
+		; a second hardware division.
+		tnzw y
+		jrne 0013$
+		ldw y, (ARG_DIVISOR_SP_OFFSET+2, sp)
+		divw x, y
+		jra 0018$
+
+	0013$:
+		; If the divisor is less than 0x100, the remainder will also be, so the
+		; low word can be divided one byte at a time, with each byte combined
+		; with the previous remainder to form a 16-bit dividend for an 8-bit
+		; hardware division. Otherwise, skip ahead.
+		tnz (ARG_DIVISOR_SP_OFFSET+2, sp)
+		jrne 0014$
+
+		; Divide (remainder << 8) + high byte of low word. The quotient byte
+		; (which will fit in XL) is stored back in place of the dividend arg.
+		ld a, yl
+		ld xh, a
+		ld a, (ARG_DIVIDEND_SP_OFFSET+2, sp)
+		ld xl, a
+		ld a, (ARG_DIVISOR_SP_OFFSET+3, sp)
+		div x, a
+		exg a, xl
+		ld (ARG_DIVIDEND_SP_OFFSET+2, sp), a
+
+		; Divide (remainder << 8) + low byte of low word. Put the remainder in
+		; Y and the quotient bytes together in X.
+		ld a, xl
+		ld xh, a
+		ld a, (ARG_DIVIDEND_SP_OFFSET+3, sp)
+		ld xl, a
+		ld a, (ARG_DIVISOR_SP_OFFSET+3, sp)
+		div x, a
+		clrw y
+		ld yl, a
+		ld a, (ARG_DIVIDEND_SP_OFFSET+2, sp)
+		ld xh, a
+		jra 0018$
+
+	0014$:
+		; Otherwise, do a 16-iteration binary long division of the low word,
+		; starting with the remainder from the high word. Keep the remainder in
+		; X and the dividend low word (which becomes the quotient) in Y.
+		exgw x, y
+		ld a, #16
+
+	0015$:
+		; Left shift the dividend by one, with its MSb (in carry) shifted in to
+		; the LSb of the remainder. If a 1 bit is shifted off the remainder
+		; (i.e. carry is set), it is definitely larger than the divisor, so
+		; skip the comparison.
+		sllw y
+		rlcw x
+		jrc 0016$
+
+		; If remainder >= divisor, carry on, otherwise skip ahead.
+		cpw x, (ARG_DIVISOR_SP_OFFSET+2, sp)
+		jrult 0017$
+
+	0016$:
+		; Subtract divisor from remainder and set LSb of quotient. Because the
+		; true result is less than the divisor, any overflow of the 16-bit
+		; remainder is cancelled out by the subtraction.
+		subw x, (ARG_DIVISOR_SP_OFFSET+2, sp)
+		incw y
+
+	0017$:
+		; Decrement counter and loop if not yet zero.
+		dec a
+		jrne 0015$
+
+		; Put the quotient back in X and remainder in Y.
+		exgw x, y
+
+	0018$:
+		; Store the quotient low word back in place of dividend arg, then copy
+		; the quotient and remainder to the result struct. The high word of the
+		; remainder is always zero.
+		ldw (ARG_DIVIDEND_SP_OFFSET+2, sp), x
+		ldw x, (ARG_RESULT_SP_OFFSET, sp)
+		ldw (6, x), y
+		clrw y
+		ldw (4, x), y
+		ldw y, (ARG_DIVIDEND_SP_OFFSET+0, sp)
+		ldw (x), y
+		ldw y, (ARG_DIVIDEND_SP_OFFSET+2, sp)
+		ldw (2, x), y
+
 		ASM_RETURN
 	__endasm;
 }
@@ -0,0 +1,113 @@
+/*******************************************************************************
+ *
+ * div_u32_by_3600.c - 32-bit unsigned division by constant 3600 implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+void div_u32_by_3600(uint32_t x, div_u32_t *result) __naked __stack_args {
+	(void)x;
+	(void)result;
+
+	__asm
+		; As 3600 = 225 * 2^4, first shift the dividend right by 4 bits, so that
+		; it can then be divided by 225, which fits the 8-bit divisor of the DIV
+		; instruction. The 4 bits shifted off will be the low bits of the
+		; remainder, so save them on the stack.
+		ld a, (ASM_ARGS_SP_OFFSET+3, sp)
+		and a, #0x0F
+		push a
+		ldw y, (ASM_ARGS_SP_OFFSET+1+0, sp)
+		ldw x, (ASM_ARGS_SP_OFFSET+1+2, sp)
+		srlw y
+		rrcw x
+		srlw y
+		rrcw x
+		srlw y
+		rrcw x
+		srlw y
+		rrcw x
+		ldw (ASM_ARGS_SP_OFFSET+1+0, sp), y
+		ldw (ASM_ARGS_SP_OFFSET+1+2, sp), x
+
+		; Load pointer to output struct into Y reg.
+		ldw y, (ASM_ARGS_SP_OFFSET+1+4, sp)
+
+		; Divide the high word of the dividend by 225. The quotient (in X) is
+		; the high word of the final quotient, so store it directly in the
+		; output struct.
+		ldw x, (ASM_ARGS_SP_OFFSET+1+0, sp)
+		ld a, #225
+		div x, a
+		ldw (y), x
+
+		; The remainder (in A) is less than the divisor, so combined with the
+		; next byte of the dividend, the quotient of dividing that will fit in
+		; a byte. Store the quotient byte (in XL) in the output struct.
+		ld xh, a
+		ld a, (ASM_ARGS_SP_OFFSET+1+2, sp)
+		ld xl, a
+		ld a, #225
+		div x, a
+		exg a, xl
+		ld (2, y), a
+
+		; Do the same again with the remainder and last byte of the dividend.
+		ld a, xl
+		ld xh, a
+		ld a, (ASM_ARGS_SP_OFFSET+1+3, sp)
+		ld xl, a
+		ld a, #225
+		div x, a
+
+		; Store the final quotient byte in the output struct. The quotient
+		; fits in a byte, so the high byte of X is zero, and the remainder
+		; can be swapped in to the low byte.
+		exg a, xl
+		ld (3, y), a
+
+		; Shift the remainder back left by 4 bits and combine it with the
+		; saved low bits.
+		sllw x
+		sllw x
+		sllw x
+		sllw x
+		ld a, xl
+		or a, (1, sp)
+		ld xl, a
+
+		; Copy the remainder into the output struct. The high word is always
+		; zero.
+		ldw (6, y), x
+		clrw x
+		ldw (4, y), x
+
+		; Clear up saved low bits from stack.
+		pop a
+
+		ASM_RETURN
+	__endasm;
+}
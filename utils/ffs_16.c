@@ -28,35 +28,149 @@
 #include "common.h"
 #include "../utils.h"
 
-uint8_t ffs_16(uint16_t value) __stack_args {
-	uint8_t idx = 0;
-	if(value) idx = ctz_16(value) + 1;
-	return idx;
-
-	/*
-	// This generates some bizarre, extraneous assembly (see below).
-	return (value ? ctz_16(value) + 1 : 0);
-	*/
-
-	/*
-      000019                         90 _ffs_16:
-                                     91 ;	utils\ctz_16.c: 75: return (value ? ctz_16(value) + 1 : 0);
-      000019 1E 04            [ 2]   92 	ldw	x, (0x04, sp)
-      00001B 27 0F            [ 1]   93 	jreq	00103$
-      00001D 89               [ 2]   94 	pushw	x
-      00001E 8Ds00r00r00      [ 5]   95 	callf	_ctz_16
-      000022 5B 02            [ 2]   96 	addw	sp, #2
-      000024 4C               [ 1]   97 	inc	a
-      000025 88               [ 1]   98 	push	a      ; <--
-      000026 49               [ 1]   99 	rlc	a          ; <--
-      000027 4F               [ 1]  100 	clr	a          ; <-- WTF?!?
-      000028 A2 00            [ 1]  101 	sbc	a, #0x00   ; <--
-      00002A 84               [ 1]  102 	pop	a          ; <--
-      00002B 21                     103 	.byte 0x21
-      00002C                        104 00103$:
-      00002C 4F               [ 1]  105 	clr	a
-      00002D                        106 00104$:
-                                    107 ;	utils\ctz_16.c: 76: }
-      00002D 87               [ 5]  108 	retf
-	*/
+uint8_t ffs_16(uint16_t value) __naked __stack_args {
+	(void)value;
+
+#if defined(CTZ_LUT_LARGE)
+
+	__asm
+		; Initialise result in A reg to zero, and quit straight away if the
+		; value arg is zero.
+		clr a
+		ldw x, (ASM_ARGS_SP_OFFSET+0, sp)
+		jreq 0001$
+
+		; Initialise X reg to 1. This ensures the MSB of table index is zero,
+		; but also initialises the result to 1 (i.e. index of bit 0 plus one),
+		; because the LSB is swapped in to the result.
+		ldw x, #1
+
+		; Load LSB of value arg into A reg. Shift off least-significant bit into
+		; carry. Quit if the carry is 1. Look up the zero count for now 7-bit
+		; value from the table at offset determined by value byte in X reg, and
+		; add it to result.
+		ld a, (ASM_ARGS_SP_OFFSET+1, sp)
+		srl a
+		exg a, xl
+		jrc 0001$
+		add a, (_ctz_lut_large, x)
+
+		; If the result is now anything less than 9 (i.e. last byte was not all
+		; zeroes), then quit.
+		cp a, #9
+		jrne 0001$
+
+		; Swap the result from A into LSB of X reg for safe-keeping.
+		exg a, xl
+
+		; Do the same table look-up as before, but with MSB of value arg. This
+		; cannot be zero, because the value is non-zero.
+		ld a, (ASM_ARGS_SP_OFFSET+0, sp)
+		srl a
+		exg a, xl
+		jrc 0001$
+		add a, (_ctz_lut_large, x)
+
+	0001$:
+		; Return with the result in the A reg.
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		; Initialise result in A reg to zero, and load value arg into X reg.
+		; If value is zero, quit straight away.
+		clr a
+		ldw x, (ASM_ARGS_SP_OFFSET+0, sp)
+		jreq 0002$
+
+	0001$:
+		; Increment the result and shift the value right one bit. If the carry
+		; (i.e. bit shifted off) is a zero, loop around. The value is non-zero,
+		; so a one will always be encountered.
+		inc a
+		srlw x
+		jrnc 0001$
+
+	0002$:
+		; Return with the result in the A reg.
+		ASM_RETURN
+	__endasm;
+
+#endif
+}
+
+#if defined(__reg_args)
+
+uint8_t ffs_16_ra(uint16_t value) __naked __reg_args {
+	(void)value;
+
+#if defined(CTZ_LUT_LARGE)
+
+	__asm
+		; Initialise result in A reg to zero. Value arg is already in X reg; if
+		; it is zero, quit straight away.
+		clr a
+		tnzw x
+		jreq 0001$
+
+		; Value arg is in X reg, so use Y reg for table index instead.
+		; Initialise Y reg to 1, for table index MSB and initial result.
+		ldw y, #1
+
+		; Load LSB of value arg into A reg. Shift off least-significant bit into
+		; carry. Quit if the carry is 1. Look up the zero count for now 7-bit
+		; value from the table at offset determined by value byte in Y reg, and
+		; add it to result.
+		ld a, xl
+		srl a
+		exg a, yl
+		jrc 0001$
+		add a, (_ctz_lut_large, y)
+
+		; If the result is now anything less than 9 (i.e. last byte was not all
+		; zeroes), then quit.
+		cp a, #9
+		jrne 0001$
+
+		; Swap the result from A into LSB of Y reg for safe-keeping.
+		exg a, yl
+
+		; Do the same table look-up as before, but with MSB of value arg.
+		ld a, xh
+		srl a
+		exg a, yl
+		jrc 0001$
+		add a, (_ctz_lut_large, y)
+
+	0001$:
+		; Return with the result in the A reg.
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		; Initialise result in A reg to zero. Value arg is already in X reg; if
+		; it is zero, quit straight away.
+		clr a
+		tnzw x
+		jreq 0002$
+
+	0001$:
+		; Increment the result and shift the value right one bit. If the carry
+		; (i.e. bit shifted off) is a zero, loop around.
+		inc a
+		srlw x
+		jrnc 0001$
+
+	0002$:
+		; Return with the result in the A reg.
+		ASM_RETURN
+	__endasm;
+
+#endif
 }
+
+#endif
@@ -28,8 +28,108 @@
 #include "common.h"
 #include "../utils.h"
 
-uint8_t ffs_32(uint32_t value) __stack_args {
-	uint8_t idx = 0;
-	if(value) idx = ctz_32(value) + 1;
-	return idx;
+uint8_t ffs_32(uint32_t value) __naked __stack_args {
+	(void)value;
+
+#if defined(CTZ_LUT_LARGE)
+
+	__asm
+		; Initialise result in A reg to zero, and quit straight away if the
+		; value arg is zero.
+		clr a
+		ldw x, (ASM_ARGS_SP_OFFSET+0, sp)
+		jrne 0001$
+		ldw x, (ASM_ARGS_SP_OFFSET+2, sp)
+		jreq 0002$
+
+	0001$:
+		; Initialise X reg to 1. This ensures the MSB of table index is zero,
+		; but also initialises the result to 1 (i.e. index of bit 0 plus one),
+		; because the LSB is swapped in to the result.
+		ldw x, #1
+
+		; Load fourth byte of value arg into A reg. Shift off least-significant
+		; bit into carry. Quit if the carry is 1. Look up the zero count for now
+		; 7-bit value from the table at offset determined by value byte in X
+		; reg, and add it to result.
+		ld a, (ASM_ARGS_SP_OFFSET+3, sp)
+		srl a
+		exg a, xl
+		jrc 0002$
+		add a, (_ctz_lut_large, x)
+
+		; If the result is now anything less than 9 (i.e. last byte was not all
+		; zeroes), then quit.
+		cp a, #9
+		jrne 0002$
+
+		; Swap the result from A into LSB of X reg for safe-keeping.
+		exg a, xl
+
+		; Do the same table look-up as before, but with 3rd byte of value arg.
+		ld a, (ASM_ARGS_SP_OFFSET+2, sp)
+		srl a
+		exg a, xl
+		jrc 0002$
+		add a, (_ctz_lut_large, x)
+
+		; Quit if result is anything less than 17.
+		cp a, #17
+		jrne 0002$
+
+		exg a, xl
+
+		; Second byte of value arg.
+		ld a, (ASM_ARGS_SP_OFFSET+1, sp)
+		srl a
+		exg a, xl
+		jrc 0002$
+		add a, (_ctz_lut_large, x)
+
+		; Quit if result is anything less than 25.
+		cp a, #25
+		jrne 0002$
+
+		exg a, xl
+
+		; First byte of value arg. This cannot be zero, because the value is
+		; non-zero.
+		ld a, (ASM_ARGS_SP_OFFSET+0, sp)
+		srl a
+		exg a, xl
+		jrc 0002$
+		add a, (_ctz_lut_large, x)
+
+	0002$:
+		; Return with the result in the A reg.
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		; Initialise result in A reg to zero, and load value arg into X & Y
+		; regs. If value is zero, quit straight away.
+		clr a
+		ldw x, (ASM_ARGS_SP_OFFSET+2, sp)
+		ldw y, (ASM_ARGS_SP_OFFSET+0, sp)
+		jrne 0001$
+		tnzw x
+		jreq 0002$
+
+	0001$:
+		; Increment the result and shift the value right one bit. If the carry
+		; (i.e. bit shifted off) is a zero, loop around. The value is non-zero,
+		; so a one will always be encountered.
+		inc a
+		srlw y
+		rrcw x
+		jrnc 0001$
+
+	0002$:
+		; Return with the result in the A reg.
+		ASM_RETURN
+	__endasm;
+
+#endif
 }
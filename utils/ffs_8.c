@@ -28,8 +28,117 @@
 #include "common.h"
 #include "../utils.h"
 
-uint8_t ffs_8(uint8_t value) __stack_args {
-	uint8_t idx = 0;
-	if(value) idx = ctz_8(value) + 1;
-	return idx;
+uint8_t ffs_8(uint8_t value) __naked __stack_args {
+	(void)value;
+
+#if defined(CTZ_LUT_LARGE)
+
+	__asm
+		; Load value arg into A reg. If it is zero, quit with a result of zero.
+		ld a, (ASM_ARGS_SP_OFFSET+0, sp)
+		jreq 0001$
+
+		; Initialise X reg to 1. This ensures the MSB of table index is zero,
+		; but also initialises the result to 1 (i.e. index of bit 0 plus one),
+		; because the LSB is swapped in to the result.
+		ldw x, #1
+
+		; Shift off least-significant bit into carry. Quit if the carry is 1.
+		; Look up the zero count for now 7-bit value from the table at offset
+		; determined by value byte in X reg, and add it to result.
+		srl a
+		exg a, xl
+		jrc 0001$
+		add a, (_ctz_lut_large, x)
+
+	0001$:
+		; Return with the result in the A reg.
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		; Load value arg into A reg. If it is zero, quit with a result of zero.
+		ld a, (ASM_ARGS_SP_OFFSET+0, sp)
+		jreq 0002$
+
+		; Initialise result in X reg to zero.
+		clrw x
+
+	0001$:
+		; Increment the result and shift the value right one bit. If the carry
+		; (i.e. bit shifted off) is a zero, loop around. The value is non-zero,
+		; so a one will always be encountered.
+		incw x
+		srl a
+		jrnc 0001$
+
+		; Copy the result to the A reg for return value.
+		ld a, xl
+
+	0002$:
+		ASM_RETURN
+	__endasm;
+
+#endif
+}
+
+#if defined(__reg_args)
+
+uint8_t ffs_8_ra(uint8_t value) __naked __reg_args {
+	(void)value;
+
+#if defined(CTZ_LUT_LARGE)
+
+	__asm
+		; Value arg is already in A reg. If it is zero, quit with a result of
+		; zero.
+		tnz a
+		jreq 0001$
+
+		; Initialise X reg to 1, for table index MSB and initial result.
+		ldw x, #1
+
+		; Shift off least-significant bit into carry. Quit if the carry is 1.
+		; Look up the zero count for now 7-bit value from the table at offset
+		; determined by value byte in X reg, and add it to result.
+		srl a
+		exg a, xl
+		jrc 0001$
+		add a, (_ctz_lut_large, x)
+
+	0001$:
+		; Return with the result in the A reg.
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		; Value arg is already in A reg. If it is zero, quit with a result of
+		; zero.
+		tnz a
+		jreq 0002$
+
+		; Initialise result in X reg to zero.
+		clrw x
+
+	0001$:
+		; Increment the result and shift the value right one bit. If the carry
+		; (i.e. bit shifted off) is a zero, loop around.
+		incw x
+		srl a
+		jrnc 0001$
+
+		; Copy the result to the A reg for return value.
+		ld a, xl
+
+	0002$:
+		ASM_RETURN
+	__endasm;
+
+#endif
 }
+
+#endif
@@ -0,0 +1,210 @@
+/*******************************************************************************
+ *
+ * ffs_bitmap.c - Bitmap find-first-set implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+uint16_t ffs_bitmap(const uint8_t *bitmap, uint16_t len) __naked __stack_args {
+	(void)bitmap;
+	(void)len;
+
+	// For return value: 0xAABB
+	// x = 0xAABB (xh = 0xAA, xl = 0xBB)
+
+#if defined(CTZ_LUT_LARGE)
+
+	__asm
+		; Offsets for arguments.
+		BITMAP_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		LEN_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+
+		; Load length arg into X reg. If it is zero, quit straight away with a
+		; result of zero.
+		ldw x, (LEN_SP_OFFSET, sp)
+		jreq 0003$
+
+		; Calculate the end pointer by adding length to the bitmap pointer, and
+		; store it in place of the length arg. Load the bitmap pointer into the
+		; X reg.
+		addw x, (BITMAP_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw x, (BITMAP_SP_OFFSET, sp)
+
+		; If the number of bytes remaining is odd (i.e. the pointer and end
+		; pointer differ in their least-significant bit), check the next byte
+		; on its own first, so that the remainder can be scanned a whole word
+		; at a time without reading beyond the end.
+		ld a, xl
+		xor a, (LEN_SP_OFFSET+1, sp)
+		srl a
+		jrnc 0002$
+		ld a, (x)
+		jrne 0005$
+		incw x
+		jra 0002$
+
+	0001$:
+		; Load the next two bytes into the Y reg, via a copy of the pointer, and
+		; if either is non-zero, stop scanning. Otherwise, advance the pointer.
+		ldw y, x
+		ldw y, (y)
+		jrne 0004$
+		addw x, #2
+
+	0002$:
+		; Loop around if not yet at the end. If we are, no set bit was found,
+		; so quit with a result of zero.
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+	0003$:
+		clrw x
+		ASM_RETURN
+
+	0004$:
+		; Determine which of the two bytes contains the set bit. The byte at
+		; the lower address (the MSB of the Y reg) holds the lower bits, so
+		; if it is non-zero, use it. Otherwise, use the byte at the next
+		; address.
+		ld a, yh
+		tnz a
+		jrne 0005$
+		incw x
+		ld a, yl
+
+	0005$:
+		; The A reg now contains the first non-zero byte, and the X reg points
+		; to it. Calculate the index of its first bit by subtracting the bitmap
+		; pointer and multiplying by 8.
+		subw x, (BITMAP_SP_OFFSET, sp)
+		sllw x
+		sllw x
+		sllw x
+
+		; Initialise Y reg to 1. This ensures the MSB of table index is zero,
+		; but also initialises the bit position to 1, because the LSB is
+		; swapped in. Shift off least-significant bit into carry. If the carry
+		; is 0, look up the zero count for now 7-bit value from the table at
+		; offset determined by value byte in Y reg, and add it to position.
+		ldw y, #1
+		srl a
+		exg a, yl
+		jrc 0006$
+		add a, (_ctz_lut_large, y)
+
+	0006$:
+		; Add the bit position to the bit index to give the result, using the
+		; space of the length arg (which is no longer needed) as a temporary
+		; 16-bit value.
+		ld (LEN_SP_OFFSET+1, sp), a
+		clr (LEN_SP_OFFSET+0, sp)
+		addw x, (LEN_SP_OFFSET, sp)
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		; Offsets for arguments.
+		BITMAP_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		LEN_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+
+		; Load length arg into X reg. If it is zero, quit straight away with a
+		; result of zero.
+		ldw x, (LEN_SP_OFFSET, sp)
+		jreq 0003$
+
+		; Calculate the end pointer by adding length to the bitmap pointer, and
+		; store it in place of the length arg. Load the bitmap pointer into the
+		; X reg.
+		addw x, (BITMAP_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw x, (BITMAP_SP_OFFSET, sp)
+
+		; If the number of bytes remaining is odd (i.e. the pointer and end
+		; pointer differ in their least-significant bit), check the next byte
+		; on its own first, so that the remainder can be scanned a whole word
+		; at a time without reading beyond the end.
+		ld a, xl
+		xor a, (LEN_SP_OFFSET+1, sp)
+		srl a
+		jrnc 0002$
+		ld a, (x)
+		jrne 0005$
+		incw x
+		jra 0002$
+
+	0001$:
+		; Load the next two bytes into the Y reg, via a copy of the pointer, and
+		; if either is non-zero, stop scanning. Otherwise, advance the pointer.
+		ldw y, x
+		ldw y, (y)
+		jrne 0004$
+		addw x, #2
+
+	0002$:
+		; Loop around if not yet at the end. If we are, no set bit was found,
+		; so quit with a result of zero.
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+	0003$:
+		clrw x
+		ASM_RETURN
+
+	0004$:
+		; Determine which of the two bytes contains the set bit. The byte at
+		; the lower address (the MSB of the Y reg) holds the lower bits, so
+		; if it is non-zero, use it. Otherwise, use the byte at the next
+		; address.
+		ld a, yh
+		tnz a
+		jrne 0005$
+		incw x
+		ld a, yl
+
+	0005$:
+		; The A reg now contains the first non-zero byte, and the X reg points
+		; to it. Calculate the index of its first bit by subtracting the bitmap
+		; pointer and multiplying by 8.
+		subw x, (BITMAP_SP_OFFSET, sp)
+		sllw x
+		sllw x
+		sllw x
+
+	0006$:
+		; Increment the result and shift the byte right one bit. If the carry
+		; (i.e. bit shifted off) is a zero, loop around. The byte is non-zero,
+		; so a one will always be encountered.
+		incw x
+		srl a
+		jrnc 0006$
+		ASM_RETURN
+	__endasm;
+
+#endif
+}
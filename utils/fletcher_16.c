@@ -0,0 +1,101 @@
+/*******************************************************************************
+ *
+ * fletcher_16.c - Fletcher-16 checksum implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+uint16_t fletcher_16_update(uint16_t sum, const uint8_t *buf, uint16_t len) __naked __stack_args {
+	(void)sum;
+	(void)buf;
+	(void)len;
+
+	// For return value: 0xAABB
+	// x = 0xAABB (xh = 0xAA, xl = 0xBB)
+
+	__asm
+		; Offsets for arguments.
+		SUM_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		BUF_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+		LEN_SP_OFFSET = ASM_ARGS_SP_OFFSET + 4
+
+		; If the length is zero, skip straight to the end, returning the sum
+		; unchanged.
+		ldw x, (LEN_SP_OFFSET, sp)
+		jreq 0002$
+
+		; Calculate the end pointer by adding length to the buffer pointer, and
+		; store it in place of the length arg. Load the buffer pointer into the
+		; X reg.
+		addw x, (BUF_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw x, (BUF_SP_OFFSET, sp)
+
+		; Load the first sum (the LSB of the sum arg) into the A reg. The second
+		; sum (the MSB) is held in place of the arg.
+		ld a, (SUM_SP_OFFSET+1, sp)
+
+	0001$:
+		; Add the next byte from the buffer to the first sum, then add the
+		; first sum to the second. Each addition is done with end-around carry
+		; (i.e. adding any carry back in), which reduces the sums modulo 255
+		; as we go, with no need for division. The only difference to a true
+		; modulo is that zero may also be represented as 0xFF.
+		add a, (x)
+		adc a, #0
+		ld yl, a
+		add a, (SUM_SP_OFFSET+0, sp)
+		adc a, #0
+		ld (SUM_SP_OFFSET+0, sp), a
+		ld a, yl
+
+		; Advance the pointer and loop around if not yet at the end.
+		incw x
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+		; Store the first sum back in place of the arg.
+		ld (SUM_SP_OFFSET+1, sp), a
+
+	0002$:
+		; Load both sums into the X reg, and convert either of them that is
+		; 0xFF to zero.
+		ldw x, (SUM_SP_OFFSET, sp)
+		ld a, xl
+		cp a, #0xFF
+		jrne 0003$
+		clr a
+		ld xl, a
+	0003$:
+		ld a, xh
+		cp a, #0xFF
+		jrne 0004$
+		clr a
+		ld xh, a
+	0004$:
+		ASM_RETURN
+	__endasm;
+}
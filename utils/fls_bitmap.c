@@ -0,0 +1,203 @@
+/*******************************************************************************
+ *
+ * fls_bitmap.c - Bitmap find-last-set implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+uint16_t fls_bitmap(const uint8_t *bitmap, uint16_t len) __naked __stack_args {
+	(void)bitmap;
+	(void)len;
+
+	// For return value: 0xAABB
+	// x = 0xAABB (xh = 0xAA, xl = 0xBB)
+
+#if defined(CLZ_LUT_LARGE)
+
+	__asm
+		; Offsets for arguments.
+		BITMAP_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		LEN_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+
+		; Load length arg into X reg. If it is zero, quit straight away with a
+		; result of zero.
+		ldw x, (LEN_SP_OFFSET, sp)
+		jreq 0003$
+
+		; Calculate the end pointer by adding length to the bitmap pointer, and
+		; keep it in the X reg, as the bitmap is scanned backwards from the end.
+		addw x, (BITMAP_SP_OFFSET, sp)
+
+		; If the length is odd, check the last byte on its own first, so that
+		; the remainder can be scanned a whole word at a time.
+		ld a, (LEN_SP_OFFSET+1, sp)
+		srl a
+		jrnc 0002$
+		decw x
+		ld a, (x)
+		jrne 0005$
+		jra 0002$
+
+	0001$:
+		; Move the pointer back and load the previous two bytes into the Y reg,
+		; via a copy of the pointer. If either is non-zero, stop scanning.
+		subw x, #2
+		ldw y, x
+		ldw y, (y)
+		jrne 0004$
+
+	0002$:
+		; Loop around if not yet at the start. If we are, no set bit was found,
+		; so quit with a result of zero.
+		cpw x, (BITMAP_SP_OFFSET, sp)
+		jrne 0001$
+
+	0003$:
+		clrw x
+		ASM_RETURN
+
+	0004$:
+		; Determine which of the two bytes contains the set bit. The byte at
+		; the higher address (the LSB of the Y reg) holds the higher bits, so
+		; if it is non-zero, use it. Otherwise, use the byte at the lower
+		; address.
+		incw x
+		ld a, yl
+		tnz a
+		jrne 0005$
+		decw x
+		ld a, yh
+
+	0005$:
+		; The A reg now contains the last non-zero byte, and the X reg points
+		; to it. Calculate the index of the bit following its last bit by
+		; subtracting the bitmap pointer, adding one, and multiplying by 8.
+		subw x, (BITMAP_SP_OFFSET, sp)
+		incw x
+		sllw x
+		sllw x
+		sllw x
+
+		; Initialise Y reg to zero, to ensure the MSB of table index is zero,
+		; and put the byte in its LSB. If the most-significant bit is set, the
+		; result is already correct, so quit. Otherwise, look up the leading
+		; zero count from the table at offset determined by value byte in Y
+		; reg.
+		clrw y
+		ld yl, a
+		tnz a
+		jrmi 0006$
+		ld a, (_clz_lut_large, y)
+
+		; Subtract the leading zero count from the index to give the result,
+		; using the space of the length arg (which is no longer needed) as a
+		; temporary 16-bit value.
+		ld (LEN_SP_OFFSET+1, sp), a
+		clr (LEN_SP_OFFSET+0, sp)
+		subw x, (LEN_SP_OFFSET, sp)
+
+	0006$:
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		; Offsets for arguments.
+		BITMAP_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		LEN_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+
+		; Load length arg into X reg. If it is zero, quit straight away with a
+		; result of zero.
+		ldw x, (LEN_SP_OFFSET, sp)
+		jreq 0003$
+
+		; Calculate the end pointer by adding length to the bitmap pointer, and
+		; keep it in the X reg, as the bitmap is scanned backwards from the end.
+		addw x, (BITMAP_SP_OFFSET, sp)
+
+		; If the length is odd, check the last byte on its own first, so that
+		; the remainder can be scanned a whole word at a time.
+		ld a, (LEN_SP_OFFSET+1, sp)
+		srl a
+		jrnc 0002$
+		decw x
+		ld a, (x)
+		jrne 0005$
+		jra 0002$
+
+	0001$:
+		; Move the pointer back and load the previous two bytes into the Y reg,
+		; via a copy of the pointer. If either is non-zero, stop scanning.
+		subw x, #2
+		ldw y, x
+		ldw y, (y)
+		jrne 0004$
+
+	0002$:
+		; Loop around if not yet at the start. If we are, no set bit was found,
+		; so quit with a result of zero.
+		cpw x, (BITMAP_SP_OFFSET, sp)
+		jrne 0001$
+
+	0003$:
+		clrw x
+		ASM_RETURN
+
+	0004$:
+		; Determine which of the two bytes contains the set bit. The byte at
+		; the higher address (the LSB of the Y reg) holds the higher bits, so
+		; if it is non-zero, use it. Otherwise, use the byte at the lower
+		; address.
+		incw x
+		ld a, yl
+		tnz a
+		jrne 0005$
+		decw x
+		ld a, yh
+
+	0005$:
+		; The A reg now contains the last non-zero byte, and the X reg points
+		; to it. Calculate the index of its first bit by subtracting the bitmap
+		; pointer and multiplying by 8.
+		subw x, (BITMAP_SP_OFFSET, sp)
+		sllw x
+		sllw x
+		sllw x
+
+	0006$:
+		; Increment the result and shift the byte right one bit, looping around
+		; until it is zero. The byte is non-zero, so the result is incremented
+		; at least once, and once for each bit up to and including the last set
+		; bit.
+		incw x
+		srl a
+		jrne 0006$
+		ASM_RETURN
+	__endasm;
+
+#endif
+}
@@ -0,0 +1,274 @@
+/*******************************************************************************
+ *
+ * hamming_buf.c - buffer Hamming distance implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+uint16_t hamming_buf(const uint8_t *a, const uint8_t *b, uint16_t len) __naked __stack_args {
+	(void)a;
+	(void)b;
+	(void)len;
+
+	// For return value: 0xAABB
+	// x = 0xAABB (xh = 0xAA, xl = 0xBB)
+
+#if defined(POP_COUNT_LUT_LARGE)
+
+	__asm
+		; Offsets and sizes for all stack-held variables and arguments.
+		COUNT_SP_OFFSET = 1
+		COUNT_SP_SIZE = 2
+		A_SP_OFFSET = COUNT_SP_OFFSET + COUNT_SP_SIZE + (ASM_ARGS_SP_OFFSET - 1)
+		A_SP_SIZE = 2
+		B_SP_OFFSET = A_SP_OFFSET + A_SP_SIZE
+		B_SP_SIZE = 2
+		LEN_SP_OFFSET = B_SP_OFFSET + B_SP_SIZE
+		LEN_SP_SIZE = 2
+
+		; If the length is zero, quit straight away with a count of zero.
+		ldw x, (ASM_ARGS_SP_OFFSET+4, sp)
+		jreq 0003$
+
+		; Allocate count on the stack, initialised to zero.
+		clrw x
+		pushw x
+
+		; Calculate the end pointer by adding length to the pointer to buffer
+		; a, and store it in place of the length arg. Calculate the difference
+		; between pointers to buffers b and a, so that the same position in b
+		; can be found from a, and store it in place of the b pointer arg.
+		; Load the a pointer into the X reg.
+		ldw x, (A_SP_OFFSET, sp)
+		addw x, (LEN_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw x, (B_SP_OFFSET, sp)
+		subw x, (A_SP_OFFSET, sp)
+		ldw (B_SP_OFFSET, sp), x
+		ldw x, (A_SP_OFFSET, sp)
+
+	0001$:
+		; Load the next byte from buffer b, by adding the difference to the a
+		; pointer, and XOR it with the byte from buffer a, giving the bits that
+		; differ.
+		ldw y, x
+		addw y, (B_SP_OFFSET, sp)
+		ld a, (y)
+		xor a, (x)
+
+		; Initialise Y reg to zero, which is used as the table index, so this
+		; ensures its MSB is zero. Shift off least-significant bit into carry,
+		; then put into LSB of Y reg. Look up the bit count for the now 7-bit
+		; value from the table at offset determined by value byte in Y reg, and
+		; add it together with carry bit to count.
+		clrw y
+		srl a
+		ld yl, a
+		ld a, (_pop_count_lut_large, y)
+		adc a, (COUNT_SP_OFFSET+1, sp)
+		ld (COUNT_SP_OFFSET+1, sp), a
+		jrnc 0002$
+		inc (COUNT_SP_OFFSET+0, sp)
+
+	0002$:
+		; Advance the buffer pointer and loop around if not yet at the end.
+		incw x
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+		; Pop the count from the stack into the X reg for return value.
+		popw x
+
+	0003$:
+		ASM_RETURN
+	__endasm;
+
+#elif defined(POP_COUNT_LUT_SMALL)
+
+	__asm
+		; Offsets and sizes for all stack-held variables and arguments.
+		COUNT_SP_OFFSET = 1
+		COUNT_SP_SIZE = 2
+		TEMP_SP_OFFSET = COUNT_SP_OFFSET + COUNT_SP_SIZE
+		TEMP_SP_SIZE = 1
+		A_SP_OFFSET = TEMP_SP_OFFSET + TEMP_SP_SIZE + (ASM_ARGS_SP_OFFSET - 1)
+		A_SP_SIZE = 2
+		B_SP_OFFSET = A_SP_OFFSET + A_SP_SIZE
+		B_SP_SIZE = 2
+		LEN_SP_OFFSET = B_SP_OFFSET + B_SP_SIZE
+		LEN_SP_SIZE = 2
+
+		; If the length is zero, quit straight away with a count of zero.
+		ldw x, (ASM_ARGS_SP_OFFSET+4, sp)
+		jreq 0004$
+
+		; Allocate a temporary byte on the stack, then count, initialised to
+		; zero.
+		push a
+		clrw x
+		pushw x
+
+		; Calculate the end pointer by adding length to the pointer to buffer
+		; a, and store it in place of the length arg. Calculate the difference
+		; between pointers to buffers b and a, so that the same position in b
+		; can be found from a, and store it in place of the b pointer arg.
+		; Load the a pointer into the X reg.
+		ldw x, (A_SP_OFFSET, sp)
+		addw x, (LEN_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw x, (B_SP_OFFSET, sp)
+		subw x, (A_SP_OFFSET, sp)
+		ldw (B_SP_OFFSET, sp), x
+		ldw x, (A_SP_OFFSET, sp)
+
+	0001$:
+		; Load the next byte from buffer b, by adding the difference to the a
+		; pointer, and XOR it with the byte from buffer a, giving the bits that
+		; differ.
+		ldw y, x
+		addw y, (B_SP_OFFSET, sp)
+		ld a, (y)
+		xor a, (x)
+
+		; Save the byte to the stack temporarily. Mask out the high nibble, and
+		; put it in the LSB of the Y reg (whose MSB is zeroed). Look up the bit
+		; count from the table at offset determined by nibble in Y reg, and add
+		; it to count.
+		ld (TEMP_SP_OFFSET, sp), a
+		and a, #0x0F
+		clrw y
+		ld yl, a
+		ld a, (_pop_count_lut_small, y)
+		add a, (COUNT_SP_OFFSET+1, sp)
+		ld (COUNT_SP_OFFSET+1, sp), a
+		jrnc 0002$
+		inc (COUNT_SP_OFFSET+0, sp)
+
+	0002$:
+		; Re-load the byte, but swap nibbles so we work with high nibble. Mask
+		; and look-up and add to count as before.
+		ld a, (TEMP_SP_OFFSET, sp)
+		swap a
+		and a, #0x0F
+		ld yl, a
+		ld a, (_pop_count_lut_small, y)
+		add a, (COUNT_SP_OFFSET+1, sp)
+		ld (COUNT_SP_OFFSET+1, sp), a
+		jrnc 0003$
+		inc (COUNT_SP_OFFSET+0, sp)
+
+	0003$:
+		; Advance the buffer pointer and loop around if not yet at the end.
+		incw x
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+		; Pop the count from the stack into the X reg for return value, and
+		; discard the temporary byte.
+		popw x
+		pop a
+
+	0004$:
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		; Offsets and sizes for all stack-held variables and arguments.
+		COUNT_SP_OFFSET = 1
+		COUNT_SP_SIZE = 2
+		A_SP_OFFSET = COUNT_SP_OFFSET + COUNT_SP_SIZE + (ASM_ARGS_SP_OFFSET - 1)
+		A_SP_SIZE = 2
+		B_SP_OFFSET = A_SP_OFFSET + A_SP_SIZE
+		B_SP_SIZE = 2
+		LEN_SP_OFFSET = B_SP_OFFSET + B_SP_SIZE
+		LEN_SP_SIZE = 2
+
+		; If the length is zero, quit straight away with a count of zero.
+		ldw x, (ASM_ARGS_SP_OFFSET+4, sp)
+		jreq 0004$
+
+		; Allocate count on the stack, initialised to zero.
+		clrw x
+		pushw x
+
+		; Calculate the end pointer by adding length to the pointer to buffer
+		; a, and store it in place of the length arg. Calculate the difference
+		; between pointers to buffers b and a, so that the same position in b
+		; can be found from a, and store it in place of the b pointer arg.
+		; Load the a pointer into the X reg.
+		ldw x, (A_SP_OFFSET, sp)
+		addw x, (LEN_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw x, (B_SP_OFFSET, sp)
+		subw x, (A_SP_OFFSET, sp)
+		ldw (B_SP_OFFSET, sp), x
+		ldw x, (A_SP_OFFSET, sp)
+
+	0001$:
+		; Load the next byte from buffer b, by adding the difference to the a
+		; pointer, and XOR it with the byte from buffer a, giving the bits that
+		; differ.
+		ldw y, x
+		addw y, (B_SP_OFFSET, sp)
+		ld a, (y)
+		xor a, (x)
+
+		; Put the byte into the Y reg. This also initialises A, the count for
+		; this byte, to zero.
+		clrw y
+		exg a, yl
+
+	0002$:
+		; Shift the byte right one bit, then add carry (i.e. bit shifted off)
+		; to the byte count. Keep looping and doing this until byte is zero.
+		srlw y
+		adc a, #0
+		tnzw y
+		jrne 0002$
+
+		; Add the byte count to the total count.
+		add a, (COUNT_SP_OFFSET+1, sp)
+		ld (COUNT_SP_OFFSET+1, sp), a
+		jrnc 0003$
+		inc (COUNT_SP_OFFSET+0, sp)
+
+	0003$:
+		; Advance the buffer pointer and loop around if not yet at the end.
+		incw x
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+		; Pop the count from the stack into the X reg for return value.
+		popw x
+
+	0004$:
+		ASM_RETURN
+	__endasm;
+
+#endif
+}
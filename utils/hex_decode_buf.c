@@ -0,0 +1,107 @@
+/*******************************************************************************
+ *
+ * hex_decode_buf.c - Hexadecimal string to buffer implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+bool hex_decode_buf(uint8_t *dst, const char *src, uint16_t len) __naked __stack_args {
+	(void)dst;
+	(void)src;
+	(void)len;
+
+	__asm
+		; Offsets for arguments.
+		DST_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		SRC_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+		LEN_SP_OFFSET = ASM_ARGS_SP_OFFSET + 4
+
+		; If the length is zero, quit straight away with a result of true.
+		ldw x, (LEN_SP_OFFSET, sp)
+		jreq 0004$
+
+		; Calculate the destination end pointer by adding length to the
+		; destination pointer, and store it in place of the length arg. Load
+		; the source pointer into the Y reg and the destination pointer into
+		; the X reg.
+		addw x, (DST_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw y, (SRC_SP_OFFSET, sp)
+		ldw x, (DST_SP_OFFSET, sp)
+
+	0001$:
+		; Convert the first character to a nibble value. Subtracting the
+		; ASCII code for '0' gives the value of a decimal digit directly. For
+		; any other character, set bit 5 (which makes upper- and lower-case
+		; letters the same), and subtract again so that 'A' or 'a' becomes
+		; zero. If the result is 6 or more, it is not a hex digit, so quit
+		; with a result of false; otherwise, add 10 to get the value.
+		ld a, (y)
+		sub a, #0x30
+		cp a, #10
+		jrult 0002$
+		or a, #0x20
+		sub a, #0x31
+		cp a, #6
+		jruge 0005$
+		add a, #10
+	0002$:
+		; Swap the value into the upper nibble and store it in the next
+		; destination byte.
+		swap a
+		ld (x), a
+
+		; Convert the second character in the same manner, and OR it into the
+		; lower nibble of the destination byte.
+		ld a, (1, y)
+		sub a, #0x30
+		cp a, #10
+		jrult 0003$
+		or a, #0x20
+		sub a, #0x31
+		cp a, #6
+		jruge 0005$
+		add a, #10
+	0003$:
+		or a, (x)
+		ld (x), a
+
+		; Advance both pointers and loop around if not yet at the end.
+		addw y, #2
+		incw x
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+	0004$:
+		ld a, #1
+		ASM_RETURN
+
+	0005$:
+		clr a
+		ASM_RETURN
+	__endasm;
+}
@@ -0,0 +1,105 @@
+/*******************************************************************************
+ *
+ * hex_encode_buf.c - Buffer to hexadecimal string implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+void hex_encode_buf(char *dst, const uint8_t *src, uint16_t len, bool lower) __naked __stack_args {
+	(void)dst;
+	(void)src;
+	(void)len;
+	(void)lower;
+
+	__asm
+		; Offsets for arguments.
+		DST_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		SRC_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+		LEN_SP_OFFSET = ASM_ARGS_SP_OFFSET + 4
+		LOWER_SP_OFFSET = ASM_ARGS_SP_OFFSET + 6
+
+		; Convert the lower-case flag into the amount that must be added to a
+		; nibble value of 10 or more, after adding the ASCII code for '0', to
+		; give the ASCII code for a letter: 0x07 for 'A' or 0x27 for 'a'. This
+		; is stored in place of the flag arg.
+		ld a, (LOWER_SP_OFFSET, sp)
+		neg a
+		and a, #0x20
+		add a, #0x07
+		ld (LOWER_SP_OFFSET, sp), a
+
+		; Calculate the destination end pointer by adding twice the length to
+		; the destination pointer, and store it in place of the length arg.
+		; Load the source pointer into the Y reg and the destination pointer
+		; into the X reg.
+		ldw x, (LEN_SP_OFFSET, sp)
+		sllw x
+		addw x, (DST_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw y, (SRC_SP_OFFSET, sp)
+		ldw x, (DST_SP_OFFSET, sp)
+		jra 0004$
+
+	0001$:
+		; Swap the upper nibble of the next source byte into the lower
+		; position and convert it to an ASCII character. Store it as the first
+		; character.
+		ld a, (y)
+		swap a
+		and a, #0x0F
+		add a, #0x30
+		cp a, #0x3A
+		jrult 0002$
+		add a, (LOWER_SP_OFFSET, sp)
+	0002$:
+		ld (x), a
+
+		; Convert the lower nibble in the same manner and store it as the
+		; second character.
+		ld a, (y)
+		and a, #0x0F
+		add a, #0x30
+		cp a, #0x3A
+		jrult 0003$
+		add a, (LOWER_SP_OFFSET, sp)
+	0003$:
+		ld (1, x), a
+
+		; Advance both pointers.
+		incw y
+		addw x, #2
+
+	0004$:
+		; Loop around if not yet at the end.
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+		; Null-terminate the string.
+		clr (x)
+		ASM_RETURN
+	__endasm;
+}
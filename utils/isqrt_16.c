@@ -0,0 +1,183 @@
+/*******************************************************************************
+ *
+ * isqrt_16.c - 16-bit integer square root implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+// The square root is found by the digit-by-digit (shift-and-subtract) method,
+// which works like long division. Pairs of bits of the value are shifted in to
+// a remainder, from which a trial subtrahend of 4 * root + 1 (i.e. the partial
+// root so far with '01' appended) is subtracted. If it goes, the next root bit
+// is a one, otherwise zero (and the remainder is restored). The trial value is
+// kept in the above form, so is updated for the next iteration by doubling
+// and adjusting the lowest bits, without needing the root itself; the root is
+// recovered from it at the end by shifting right 2 bits. Leading pairs of zero
+// bits in the value are skipped over, as they contribute nothing.
+
+uint8_t isqrt_16(uint16_t value) __naked __stack_args {
+	(void)value;
+
+	__asm
+		; Allocate the trial subtrahend on the stack, initialised to 1.
+		clrw x
+		incw x
+		pushw x
+
+		; Load value arg into Y reg and initialise iteration count in A reg.
+		ldw y, (ASM_ARGS_SP_OFFSET+2, sp)
+		ld a, #8
+
+	0001$:
+		; While the upper two bits of the value are zero, shift them off and
+		; decrement the iteration count. If the count reaches zero, the value
+		; is zero, so the root is also zero (which the trial value of 1 will
+		; give).
+		cpw y, #0x4000
+		jrnc 0002$
+		sllw y
+		sllw y
+		dec a
+		jrne 0001$
+		jra 0006$
+
+	0002$:
+		; Initialise remainder in X reg to zero.
+		clrw x
+
+	0003$:
+		; Shift the upper two bits of the value into the remainder.
+		sllw y
+		rlcw x
+		sllw y
+		rlcw x
+
+		; Subtract the trial value from the remainder. If there is a borrow, it
+		; does not go, so add it back to restore the remainder, and subtract 1
+		; from the trial value (giving 4 * root). Otherwise, add 1 (giving
+		; 4 * root + 2). Neither alters anything but the lowest two bits.
+		subw x, (1, sp)
+		jrnc 0004$
+		addw x, (1, sp)
+		dec (2, sp)
+		jra 0005$
+	0004$:
+		inc (2, sp)
+
+	0005$:
+		; Double the trial value and add 1, giving 8 * root + 1 or 8 * root + 5,
+		; which is 4 * root + 1 for the new root with a 0 or 1 bit appended.
+		sll (2, sp)
+		rlc (1, sp)
+		inc (2, sp)
+
+		; Decrement count and loop around if it is not zero.
+		dec a
+		jrne 0003$
+
+	0006$:
+		; Pop the trial value from the stack and shift it right 2 bits to get
+		; the root. Return it in the A reg.
+		popw x
+		srlw x
+		srlw x
+		ld a, xl
+		ASM_RETURN
+	__endasm;
+}
+
+#if defined(__reg_args)
+
+uint8_t isqrt_16_ra(uint16_t value) __naked __reg_args {
+	(void)value;
+
+	__asm
+		; Value arg is already in X reg; move it to Y reg.
+		ldw y, x
+
+		; Allocate the trial subtrahend on the stack, initialised to 1.
+		clrw x
+		incw x
+		pushw x
+
+		; Initialise iteration count in A reg.
+		ld a, #8
+
+	0001$:
+		; While the upper two bits of the value are zero, shift them off and
+		; decrement the iteration count. If the count reaches zero, the value
+		; is zero, so the root is also zero.
+		cpw y, #0x4000
+		jrnc 0002$
+		sllw y
+		sllw y
+		dec a
+		jrne 0001$
+		jra 0006$
+
+	0002$:
+		; Initialise remainder in X reg to zero.
+		clrw x
+
+	0003$:
+		; Shift the upper two bits of the value into the remainder.
+		sllw y
+		rlcw x
+		sllw y
+		rlcw x
+
+		; Subtract the trial value from the remainder, restoring it and taking
+		; 1 from the trial value if it does not go, otherwise adding 1.
+		subw x, (1, sp)
+		jrnc 0004$
+		addw x, (1, sp)
+		dec (2, sp)
+		jra 0005$
+	0004$:
+		inc (2, sp)
+
+	0005$:
+		; Double the trial value and add 1.
+		sll (2, sp)
+		rlc (1, sp)
+		inc (2, sp)
+
+		; Decrement count and loop around if it is not zero.
+		dec a
+		jrne 0003$
+
+	0006$:
+		; Pop the trial value from the stack and shift it right 2 bits to get
+		; the root. Return it in the A reg.
+		popw x
+		srlw x
+		srlw x
+		ld a, xl
+		ASM_RETURN
+	__endasm;
+}
+
+#endif
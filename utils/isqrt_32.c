@@ -0,0 +1,154 @@
+/*******************************************************************************
+ *
+ * isqrt_32.c - 32-bit integer square root implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+// Uses the same digit-by-digit method as isqrt_16 (see there for details), but
+// with a 24-bit remainder (which can reach 18 bits) and trial subtrahend. The
+// value is shifted in to the remainder one word at a time, in two passes of 8
+// iterations, skipping the high word entirely if it is zero.
+
+uint16_t isqrt_32(uint32_t value) __naked __stack_args {
+	(void)value;
+
+	// For return value: 0xAABB
+	// x = 0xAABB (xh = 0xAA, xl = 0xBB)
+
+	__asm
+		; Offsets and sizes for all stack-held variables and arguments.
+		TRIAL_SP_OFFSET = 1
+		TRIAL_SP_SIZE = 3
+		COUNTER_SP_OFFSET = TRIAL_SP_OFFSET + TRIAL_SP_SIZE
+		COUNTER_SP_SIZE = 1
+		PASSES_SP_OFFSET = COUNTER_SP_OFFSET + COUNTER_SP_SIZE
+		PASSES_SP_SIZE = 1
+		VALUE_SP_OFFSET = PASSES_SP_OFFSET + PASSES_SP_SIZE + (ASM_ARGS_SP_OFFSET - 1)
+
+		; Allocate stack space for variables.
+		sub sp, #(TRIAL_SP_SIZE + COUNTER_SP_SIZE + PASSES_SP_SIZE)
+
+		; Initialise trial subtrahend to 1.
+		clrw x
+		ldw (TRIAL_SP_OFFSET+0, sp), x
+		incw x
+		ldw (TRIAL_SP_OFFSET+1, sp), x
+
+		; Load the high word of the value into the Y reg, with two passes to
+		; do. If it is zero, load the low word instead, with only one pass.
+		ld a, #2
+		ldw y, (VALUE_SP_OFFSET+0, sp)
+		jrne 0001$
+		ldw y, (VALUE_SP_OFFSET+2, sp)
+		dec a
+	0001$:
+		ld (PASSES_SP_OFFSET, sp), a
+
+		; Initialise iteration count for the first pass.
+		ld a, #8
+		ld (COUNTER_SP_OFFSET, sp), a
+
+	0002$:
+		; While the upper two bits of the value word are zero, shift them off
+		; and decrement the iteration count. If the count reaches zero, the
+		; value is zero, so the root is also zero (which the trial value of 1
+		; will give).
+		cpw y, #0x4000
+		jrnc 0003$
+		sllw y
+		sllw y
+		dec (COUNTER_SP_OFFSET, sp)
+		jrne 0002$
+		jra 0007$
+
+	0003$:
+		; Initialise remainder in A and X regs to zero.
+		clrw x
+		clr a
+
+	0004$:
+		; Shift the upper two bits of the value word into the remainder.
+		sllw y
+		rlcw x
+		rlc a
+		sllw y
+		rlcw x
+		rlc a
+
+		; Subtract the trial value from the remainder. If there is a borrow, it
+		; does not go, so add it back to restore the remainder, and subtract 1
+		; from the trial value. Otherwise, add 1.
+		subw x, (TRIAL_SP_OFFSET+1, sp)
+		sbc a, (TRIAL_SP_OFFSET+0, sp)
+		jrnc 0005$
+		addw x, (TRIAL_SP_OFFSET+1, sp)
+		adc a, (TRIAL_SP_OFFSET+0, sp)
+		dec (TRIAL_SP_OFFSET+2, sp)
+		jra 0006$
+	0005$:
+		inc (TRIAL_SP_OFFSET+2, sp)
+
+	0006$:
+		; Double the trial value and add 1.
+		sll (TRIAL_SP_OFFSET+2, sp)
+		rlc (TRIAL_SP_OFFSET+1, sp)
+		rlc (TRIAL_SP_OFFSET+0, sp)
+		inc (TRIAL_SP_OFFSET+2, sp)
+
+		; Decrement count and loop around if it is not zero.
+		dec (COUNTER_SP_OFFSET, sp)
+		jrne 0004$
+
+		; Decrement the passes count, and if there is another to do, load the
+		; low word of the value into the Y reg, reset the iteration count, and
+		; go around again. The remainder MSB in A reg is saved while doing so.
+		dec (PASSES_SP_OFFSET, sp)
+		jreq 0007$
+		ldw y, (VALUE_SP_OFFSET+2, sp)
+		push a
+		ld a, #8
+		ld (COUNTER_SP_OFFSET+1, sp), a
+		pop a
+		jra 0004$
+
+	0007$:
+		; Shift the trial value right 2 bits to get the root, which is shifted
+		; out through the A reg into the X reg for return value.
+		ldw x, (TRIAL_SP_OFFSET+0, sp)
+		ld a, (TRIAL_SP_OFFSET+2, sp)
+		srlw x
+		rrc a
+		srlw x
+		rrc a
+		rlwa x
+
+		; Clear up the stack.
+		addw sp, #(TRIAL_SP_SIZE + COUNTER_SP_SIZE + PASSES_SP_SIZE)
+
+		ASM_RETURN
+	__endasm;
+}
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ *
+ * memctcmp.c - Constant-time memory comparison implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stddef.h>
+#include "common.h"
+#include "../utils.h"
+
+int memctcmp(const void *a, const void *b, size_t n) __naked __stack_args {
+	(void)a;
+	(void)b;
+	(void)n;
+
+	__asm
+		.macro memctcmp_byte offset
+			ld a, (offset, x)
+			xor a, (offset, y)
+			or a, (ACC_SP_OFFSET, sp)
+			ld (ACC_SP_OFFSET, sp), a
+		.endm
+
+		; Offsets for all stack-held variables and arguments.
+		ACC_SP_OFFSET = 1
+		ACC_SP_SIZE = 1
+		A_SP_OFFSET = ACC_SP_OFFSET + ACC_SP_SIZE + (ASM_ARGS_SP_OFFSET - 1)
+		A_SP_SIZE = 2
+		B_SP_OFFSET = A_SP_OFFSET + A_SP_SIZE
+		B_SP_SIZE = 2
+		N_SP_OFFSET = B_SP_OFFSET + B_SP_SIZE
+		N_SP_SIZE = 2
+
+		; Initialise comparison result (on stack) to zero.
+		push #0
+
+		; Calculate the end pointer by adding the length to the a pointer, and
+		; store it in place of the length arg. Load the a and b pointers into
+		; the X and Y regs.
+		ldw x, (N_SP_OFFSET, sp)
+		addw x, (A_SP_OFFSET, sp)
+		ldw (N_SP_OFFSET, sp), x
+		ldw x, (A_SP_OFFSET, sp)
+		ldw y, (B_SP_OFFSET, sp)
+
+		; The bulk of the comparison is done 4 bytes at a time, so first do
+		; the remaining 0-3 bytes (i.e. length modulo 4) individually. Which
+		; of these branches are taken depends only on the length, so the
+		; execution time still does not depend on the buffer contents.
+		ld a, (N_SP_OFFSET+1, sp)
+		sub a, (A_SP_OFFSET+1, sp)
+		and a, #0x03
+		jreq 0004$
+		cp a, #2
+		jrult 0002$
+		jreq 0001$
+
+		; Compare the current bytes from each pointer by XOR-ing them together.
+		; When same, resulting value will be zero, otherwise non-zero. Then OR
+		; that with the comparison result - as soon as there is a mismatch, it
+		; will become non-zero and stay like that as we continue through the
+		; entire length.
+		memctcmp_byte 0
+		incw x
+		incw y
+	0001$:
+		memctcmp_byte 0
+		incw x
+		incw y
+	0002$:
+		memctcmp_byte 0
+		incw x
+		incw y
+		jra 0004$
+
+	0003$:
+		; Compare the next 4 bytes in the same manner, then advance both
+		; pointers.
+		memctcmp_byte 0
+		memctcmp_byte 1
+		memctcmp_byte 2
+		memctcmp_byte 3
+		addw x, #4
+		addw y, #4
+
+	0004$:
+		; Loop around if not yet at the end.
+		cpw x, (N_SP_OFFSET, sp)
+		jrne 0003$
+
+		; Return comparison result in X register.
+		clrw x
+		pop a
+		ld xl, a
+		ASM_RETURN
+	__endasm;
+}
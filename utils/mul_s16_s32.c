@@ -0,0 +1,113 @@
+/*******************************************************************************
+ *
+ * mul_s16_s32.c - 16-bit by 16-bit to 32-bit signed multiplication
+ *                 implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+int32_t mul_s16_s32(int16_t a, int16_t b) __naked __stack_args {
+	(void)a;
+	(void)b;
+
+	// For return value: 0xAABBCCDD
+	// y = 0xAABB (yh = 0xAA, yl = 0xBB)
+	// x = 0xCCDD (xh = 0xCC, xl = 0xDD)
+
+	__asm
+		; Multiply high byte of a by low byte of b, and save the partial product
+		; on the stack.
+		ld a, (ASM_ARGS_SP_OFFSET+0, sp)
+		ld xl, a
+		ld a, (ASM_ARGS_SP_OFFSET+3, sp)
+		mul x, a
+		pushw x
+
+		; Multiply low byte of a by high byte of b, and add the previous partial
+		; product. This middle sum can be up to 17 bits, so carry holds the MSb.
+		ld a, (ASM_ARGS_SP_OFFSET+2+1, sp)
+		ld xl, a
+		ld a, (ASM_ARGS_SP_OFFSET+2+2, sp)
+		mul x, a
+		addw x, (1, sp)
+
+		; Shift the middle sum right by 8 bits, with the carry shifted in to the
+		; MSB and the LSB shifted out in to the A reg. Save both on the stack;
+		; the former is to be added to the high word of the result, and the
+		; latter to the MSB of the low word.
+		clr a
+		rlc a
+		rrwa x
+		ldw (1, sp), x
+		push a
+
+		; Multiply low byte of a by low byte of b, and add the LSB of the middle
+		; sum to the MSB, giving the low word of the result.
+		ld a, (ASM_ARGS_SP_OFFSET+3+1, sp)
+		ld xl, a
+		ld a, (ASM_ARGS_SP_OFFSET+3+3, sp)
+		mul x, a
+		ld a, xh
+		add a, (1, sp)
+		ld xh, a
+
+		; If the addition carried, increment the upper part of the middle sum.
+		jrnc 0001$
+		ldw y, (2, sp)
+		incw y
+		ldw (2, sp), y
+
+	0001$:
+		; Keep the low word in the Y reg for now.
+		ldw y, x
+
+		; Multiply high byte of a by high byte of b, and add the upper part of
+		; the middle sum, giving the high word of the result.
+		ld a, (ASM_ARGS_SP_OFFSET+3+0, sp)
+		ld xl, a
+		ld a, (ASM_ARGS_SP_OFFSET+3+2, sp)
+		mul x, a
+		addw x, (2, sp)
+
+		; The above gives the unsigned product. To convert it into the signed
+		; product, if a is negative then subtract b from the high word, and if
+		; b is negative then subtract a from the high word.
+		tnz (ASM_ARGS_SP_OFFSET+3+0, sp)
+		jrpl 0002$
+		subw x, (ASM_ARGS_SP_OFFSET+3+2, sp)
+	0002$:
+		tnz (ASM_ARGS_SP_OFFSET+3+2, sp)
+		jrpl 0003$
+		subw x, (ASM_ARGS_SP_OFFSET+3+0, sp)
+
+	0003$:
+		; Swap the high word into Y and the low word into X for return value,
+		; and clear up the stack.
+		exgw x, y
+		addw sp, #3
+		ASM_RETURN
+	__endasm;
+}
@@ -0,0 +1,42 @@
+/*******************************************************************************
+ *
+ * mul_s32_s64.c - 32-bit by 32-bit to 64-bit signed multiplication
+ *                 implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+void mul_s32_s64(int32_t a, int32_t b, mul_s64_t *result) __stack_args {
+	// Multiply the arguments with the unsigned multiplication, whose result
+	// struct has the same layout. The low word is the same either way.
+	mul_u32_u64(a, b, (mul_u64_t *)result);
+
+	// To convert the unsigned product in to the signed product, if either of
+	// the argument values are negative, the other value needs subtracting from
+	// the high word (i.e. cancelling out the 2^32 of the two's complement).
+	if(a < 0) result->hi -= (uint32_t)b;
+	if(b < 0) result->hi -= (uint32_t)a;
+}
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ *
+ * mul_u32_u64.c - 32-bit by 32-bit to 64-bit unsigned multiplication
+ *                 implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+void mul_u32_u64(uint32_t a, uint32_t b, mul_u64_t *result) __naked __stack_args {
+	(void)a;
+	(void)b;
+	(void)result;
+
+	// The product is calculated by long multiplication of the bytes of a by
+	// each byte of b in turn (i.e. rows), accumulating each 8x8 partial product
+	// in to the 64-bit result. Each step of a row multiplies one byte of a by
+	// the byte of b, then adds the carry from the previous step and the result
+	// byte at that position; the sum of which can never exceed 16 bits (0xFF *
+	// 0xFF + 0xFF + 0xFF = 0xFFFF). The LSB is stored back to the result and
+	// the MSB carried to the next step. The final carry of a row becomes the
+	// next (as yet untouched) result byte.
+
+	__asm
+		; Offsets and sizes for all stack-held variables and arguments.
+		CARRY_SP_OFFSET = 1
+		CARRY_SP_SIZE = 2
+		A_SP_OFFSET = CARRY_SP_OFFSET + CARRY_SP_SIZE + (ASM_ARGS_SP_OFFSET - 1)
+		A_SP_SIZE = 4
+		B_SP_OFFSET = A_SP_OFFSET + A_SP_SIZE
+		B_SP_SIZE = 4
+		RESULT_SP_OFFSET = B_SP_OFFSET + B_SP_SIZE
+
+		.macro mul_u32_u64_step a_idx, b_idx, r_idx
+			; Multiply the given byte of a by given byte of b, and add the carry
+			; from the previous step.
+			ld a, (A_SP_OFFSET+a_idx, sp)
+			ld xl, a
+			ld a, (B_SP_OFFSET+b_idx, sp)
+			mul x, a
+			addw x, (CARRY_SP_OFFSET, sp)
+
+			; Add the given result byte to the LSB of the sum and store it
+			; back. Add the carry from that to the MSB of the sum, which becomes
+			; the new carry (the upper byte of which is always zero).
+			ld a, xl
+			add a, (r_idx, y)
+			ld (r_idx, y), a
+			ld a, xh
+			adc a, #0
+			ld (CARRY_SP_OFFSET+1, sp), a
+		.endm
+
+		.macro mul_u32_u64_row b_idx, r_idx
+			; Multiply each byte of a, starting from the LSB, by the given byte
+			; of b, accumulating into the result bytes from the given one up.
+			clr (CARRY_SP_OFFSET+1, sp)
+			mul_u32_u64_step 3, b_idx, r_idx
+			mul_u32_u64_step 2, b_idx, r_idx-1
+			mul_u32_u64_step 1, b_idx, r_idx-2
+			mul_u32_u64_step 0, b_idx, r_idx-3
+
+			; Store the final carry from the row in to the next result byte up.
+			ld a, (CARRY_SP_OFFSET+1, sp)
+			ld (r_idx-4, y), a
+		.endm
+
+		; Allocate a 16-bit carry variable on the stack, initialised to zero.
+		clrw x
+		pushw x
+
+		; Load pointer to output struct into Y reg, and zero the low word of
+		; the result (the high word is filled by the final carry of each row).
+		ldw y, (RESULT_SP_OFFSET, sp)
+		ldw (4, y), x
+		ldw (6, y), x
+
+		; Accumulate a row of partial products for each byte of b, starting
+		; from the LSB, with each row being one byte further up the result.
+		mul_u32_u64_row 3, 7
+		mul_u32_u64_row 2, 6
+		mul_u32_u64_row 1, 5
+		mul_u32_u64_row 0, 4
+
+		; Release the carry variable from the stack.
+		popw x
+
+		ASM_RETURN
+	__endasm;
+}
@@ -0,0 +1,110 @@
+/*******************************************************************************
+ *
+ * ones_sum_16.c - Ones' complement 16-bit sum implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+uint16_t ones_sum_16_update(uint16_t sum, const uint8_t *buf, uint16_t len) __naked __stack_args {
+	(void)sum;
+	(void)buf;
+	(void)len;
+
+	// For return value: 0xAABB
+	// x = 0xAABB (xh = 0xAA, xl = 0xBB)
+
+	__asm
+		; Offsets for arguments.
+		SUM_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		BUF_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+		LEN_SP_OFFSET = ASM_ARGS_SP_OFFSET + 4
+
+		; Initialise the Y reg to zero. It is used to count the carries out of
+		; the sum, which are added back in at the end, rather than after every
+		; addition.
+		clrw y
+
+		; Calculate a pointer to the end of the whole words in the buffer, by
+		; adding the length with its least-significant bit cleared to the
+		; buffer pointer.
+		ldw x, (LEN_SP_OFFSET, sp)
+		srlw x
+		sllw x
+		addw x, (BUF_SP_OFFSET, sp)
+
+		; If the length is odd, add the final byte on its own now (order does
+		; not matter), treating it as the MSB of a word padded with a zero
+		; LSB.
+		ld a, (LEN_SP_OFFSET+1, sp)
+		srl a
+		jrnc 0001$
+		ld a, (x)
+		add a, (SUM_SP_OFFSET+0, sp)
+		ld (SUM_SP_OFFSET+0, sp), a
+		jrnc 0001$
+		incw y
+
+	0001$:
+		; Store the end pointer in place of the length arg, and load the buffer
+		; pointer into the X reg.
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw x, (BUF_SP_OFFSET, sp)
+		jra 0004$
+
+	0002$:
+		; Add the next big-endian word from the buffer to the sum, which is
+		; held in place of its arg. If there is a carry out, count it.
+		ld a, (1, x)
+		add a, (SUM_SP_OFFSET+1, sp)
+		ld (SUM_SP_OFFSET+1, sp), a
+		ld a, (x)
+		adc a, (SUM_SP_OFFSET+0, sp)
+		ld (SUM_SP_OFFSET+0, sp), a
+		jrnc 0003$
+		incw y
+
+	0003$:
+		; Advance the pointer by a word.
+		addw x, #2
+
+	0004$:
+		; Loop around if not yet at the end.
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0002$
+
+		; Add the count of carries to the sum (using the space of the length
+		; arg as a temporary), and if that also carries, add one more. The
+		; count is less than 0x8000, so this cannot carry again.
+		ldw (LEN_SP_OFFSET, sp), y
+		ldw x, (SUM_SP_OFFSET, sp)
+		addw x, (LEN_SP_OFFSET, sp)
+		jrnc 0005$
+		incw x
+
+	0005$:
+		ASM_RETURN
+	__endasm;
+}
@@ -171,3 +171,112 @@ uint8_t pop_count_16(uint16_t value) __naked __stack_args {
 
 #endif
 }
+
+#if defined(__reg_args)
+
+uint8_t pop_count_16_ra(uint16_t value) __naked __reg_args {
+	(void)value;
+
+#if defined(POP_COUNT_LUT_LARGE)
+
+	__asm
+		; Value arg is already in X reg, so use Y reg for table index instead.
+		; Initialise Y reg to zero. This ensures the MSB of table index is zero,
+		; but also initialises count to zero, because the LSB is swapped in to
+		; the count.
+		clrw y
+
+		; Load MSB of value arg into A reg. Shift off least-significant bit into
+		; carry, then swap in to LSB of Y reg. Look up the bit count for now
+		; 7-bit value from the table at offset determined by value byte in
+		; Y reg, and add it together with carry bit to count.
+		ld a, xh
+		srl a
+		exg a, yl
+		adc a, (_pop_count_lut_large, y)
+
+		; Swap the count from A into LSB of Y reg for safe-keeping.
+		exg a, yl
+
+		; Do the same table look-up as before, but with LSB of value arg.
+		ld a, xl
+		srl a
+		exg a, yl
+		adc a, (_pop_count_lut_large, y)
+
+		; Return with the count in the A reg.
+		ASM_RETURN
+	__endasm;
+
+#elif defined(POP_COUNT_LUT_SMALL)
+
+	__asm
+		; Value arg is already in X reg, so use Y reg for table index instead.
+		; Initialise Y reg to zero. This ensures the MSB of table index is zero,
+		; but also initialises count to zero, because the LSB is swapped in to
+		; the count.
+		clrw y
+
+		; Load MSB of value arg into A reg, mask out the high nibble (retaining
+		; low nibble), then swap in to LSB of Y reg. Look up the bit count from
+		; the table at offset determined by value nibble in Y reg.
+		ld a, xh
+		and a, #0x0F
+		exg a, yl
+		add a, (_pop_count_lut_small, y)
+
+		; Swap the count from A into Y reg for safe-keeping.
+		exg a, yl
+
+		; Re-load MSB of value arg into A, but swap nibbles so we work with high
+		; nibble. Mask and look-up and add to bit count as before.
+		ld a, xh
+		swap a
+		and a, #0x0F
+		exg a, yl
+		add a, (_pop_count_lut_small, y)
+
+		exg a, yl
+
+		; Same as before, but with low nibble of LSB of value arg.
+		ld a, xl
+		and a, #0x0F
+		exg a, yl
+		add a, (_pop_count_lut_small, y)
+
+		exg a, yl
+
+		; And again with high nibble of LSB of value arg.
+		ld a, xl
+		swap a
+		and a, #0x0F
+		exg a, yl
+		add a, (_pop_count_lut_small, y)
+
+		; Return with the count in the A reg.
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		; Value arg is already in X reg. Initialise count in A reg to zero.
+		clr a
+
+	0001$:
+		; Shift the value right one bit, then add carry (i.e. bit shifted off)
+		; to count. Keep looping and doing this until value is non-zero.
+		srlw x
+		adc a, #0
+		tnzw x
+		jrne 0001$
+
+		; The A reg already contains count, so leave it there as function
+		; return value.
+		ASM_RETURN
+	__endasm;
+
+#endif
+}
+
+#endif
@@ -110,3 +110,88 @@ uint8_t pop_count_8(uint8_t value) __naked __stack_args {
 
 #endif
 }
+
+#if defined(__reg_args)
+
+uint8_t pop_count_8_ra(uint8_t value) __naked __reg_args {
+	(void)value;
+
+#if defined(POP_COUNT_LUT_LARGE)
+
+	__asm
+		; Initialise X reg to zero. This ensures the MSB of table index is zero,
+		; but also initialises count to zero, because the LSB is swapped in to
+		; the count.
+		clrw x
+
+		; Value arg is already in A reg. Shift off least-significant bit into
+		; carry, then swap in to LSB of X reg. Look up the bit count for now
+		; 7-bit value from the table at offset determined by value byte in X
+		; reg, and add it together with carry bit to count.
+		srl a
+		exg a, xl
+		adc a, (_pop_count_lut_large, x)
+
+		; Return with the count in the A reg.
+		ASM_RETURN
+	__endasm;
+
+#elif defined(POP_COUNT_LUT_SMALL)
+
+	__asm
+		; Initialise X reg to zero. This ensures the MSB of table index is zero,
+		; but also initialises count to zero, because the LSB is swapped in to
+		; the count.
+		clrw x
+
+		; Keep a copy of the value arg (in A reg) in Y reg, because it is
+		; needed again for the high nibble.
+		ld yl, a
+
+		; Mask out the high nibble (retaining low nibble), then swap in to LSB
+		; of X reg. Look up the bit count from the table at offset determined by
+		; value nibble in X reg.
+		and a, #0x0F
+		exg a, xl
+		add a, (_pop_count_lut_small, x)
+
+		; Swap the count from A into X reg for safe-keeping.
+		exg a, xl
+
+		; Re-load value arg into A, but swap nibbles so we work with high
+		; nibble. Mask and look-up and add to bit count as before.
+		ld a, yl
+		swap a
+		and a, #0x0F
+		exg a, xl
+		add a, (_pop_count_lut_small, x)
+
+		; Return with the count in the A reg.
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		; Initialise X reg to zero. Swap value arg from A register into LSB of
+		; X reg. This also initialises A, the count, to zero.
+		clrw x
+		exg a, xl
+
+	0001$:
+		; Shift the value right one bit, then add carry (i.e. bit shifted off)
+		; to count. Keep looping and doing this until value is non-zero.
+		srlw x
+		adc a, #0
+		tnzw x
+		jrne 0001$
+
+		; The A reg already contains count, so leave it there as function
+		; return value.
+		ASM_RETURN
+	__endasm;
+
+#endif
+}
+
+#endif
@@ -0,0 +1,232 @@
+/*******************************************************************************
+ *
+ * pop_count_buf.c - buffer population count implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+uint16_t pop_count_buf(const uint8_t *buf, uint16_t len) __naked __stack_args {
+	(void)buf;
+	(void)len;
+
+	// For return value: 0xAABB
+	// x = 0xAABB (xh = 0xAA, xl = 0xBB)
+
+#if defined(POP_COUNT_LUT_LARGE)
+
+	__asm
+		; Offsets and sizes for all stack-held variables and arguments.
+		COUNT_HI_SP_OFFSET = 1
+		COUNT_HI_SP_SIZE = 1
+		BUF_SP_OFFSET = COUNT_HI_SP_OFFSET + COUNT_HI_SP_SIZE + (ASM_ARGS_SP_OFFSET - 1)
+		BUF_SP_SIZE = 2
+		LEN_SP_OFFSET = BUF_SP_OFFSET + BUF_SP_SIZE
+		LEN_SP_SIZE = 2
+
+		; If the length is zero, quit straight away with a count of zero.
+		ldw x, (ASM_ARGS_SP_OFFSET+2, sp)
+		jreq 0003$
+
+		; Allocate MSB of count on the stack, initialised to zero.
+		push #0
+
+		; Calculate the end pointer by adding length to the buffer pointer, and
+		; store it in place of the length arg. Load the buffer pointer into the
+		; X reg.
+		ldw x, (BUF_SP_OFFSET, sp)
+		addw x, (LEN_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw x, (BUF_SP_OFFSET, sp)
+
+		; Initialise Y reg to zero, which is used as the table index, so this
+		; ensures its MSB is zero. Initialise LSB of count in A reg to zero.
+		clrw y
+		clr a
+
+	0001$:
+		; Swap the count LSB into the Y reg for safe-keeping, then load the next
+		; byte from the buffer. Shift off least-significant bit into carry, then
+		; swap the byte back into the LSB of Y reg (and the count into A). Look
+		; up the bit count for the now 7-bit value from the table at offset
+		; determined by value byte in Y reg, and add it together with carry bit
+		; to count. If that overflows, increment the count MSB.
+		exg a, yl
+		ld a, (x)
+		srl a
+		exg a, yl
+		adc a, (_pop_count_lut_large, y)
+		jrnc 0002$
+		inc (COUNT_HI_SP_OFFSET, sp)
+
+	0002$:
+		; Advance the buffer pointer and loop around if not yet at the end.
+		incw x
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+		; Put the count MSB and LSB into the X reg for return value, and clear
+		; up the stack.
+		ld xl, a
+		pop a
+		ld xh, a
+
+	0003$:
+		ASM_RETURN
+	__endasm;
+
+#elif defined(POP_COUNT_LUT_SMALL)
+
+	__asm
+		; Offsets and sizes for all stack-held variables and arguments.
+		COUNT_SP_OFFSET = 1
+		COUNT_SP_SIZE = 2
+		BUF_SP_OFFSET = COUNT_SP_OFFSET + COUNT_SP_SIZE + (ASM_ARGS_SP_OFFSET - 1)
+		BUF_SP_SIZE = 2
+		LEN_SP_OFFSET = BUF_SP_OFFSET + BUF_SP_SIZE
+		LEN_SP_SIZE = 2
+
+		; If the length is zero, quit straight away with a count of zero.
+		ldw x, (ASM_ARGS_SP_OFFSET+2, sp)
+		jreq 0004$
+
+		; Allocate count on the stack, initialised to zero.
+		clrw x
+		pushw x
+
+		; Calculate the end pointer by adding length to the buffer pointer, and
+		; store it in place of the length arg. Load the buffer pointer into the
+		; X reg.
+		ldw x, (BUF_SP_OFFSET, sp)
+		addw x, (LEN_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw x, (BUF_SP_OFFSET, sp)
+
+		; Initialise Y reg to zero, which is used as the table index, so this
+		; ensures its MSB is zero.
+		clrw y
+
+	0001$:
+		; Load the next byte from the buffer, mask out the high nibble, and put
+		; it in the LSB of the Y reg. Look up the bit count from the table at
+		; offset determined by nibble in Y reg, and add it to count.
+		ld a, (x)
+		and a, #0x0F
+		ld yl, a
+		ld a, (_pop_count_lut_small, y)
+		add a, (COUNT_SP_OFFSET+1, sp)
+		ld (COUNT_SP_OFFSET+1, sp), a
+		jrnc 0002$
+		inc (COUNT_SP_OFFSET+0, sp)
+
+	0002$:
+		; Re-load the byte, but swap nibbles so we work with high nibble. Mask
+		; and look-up and add to count as before.
+		ld a, (x)
+		swap a
+		and a, #0x0F
+		ld yl, a
+		ld a, (_pop_count_lut_small, y)
+		add a, (COUNT_SP_OFFSET+1, sp)
+		ld (COUNT_SP_OFFSET+1, sp), a
+		jrnc 0003$
+		inc (COUNT_SP_OFFSET+0, sp)
+
+	0003$:
+		; Advance the buffer pointer and loop around if not yet at the end.
+		incw x
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+		; Pop the count from the stack into the X reg for return value.
+		popw x
+
+	0004$:
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		; Offsets and sizes for all stack-held variables and arguments.
+		COUNT_SP_OFFSET = 1
+		COUNT_SP_SIZE = 2
+		BUF_SP_OFFSET = COUNT_SP_OFFSET + COUNT_SP_SIZE + (ASM_ARGS_SP_OFFSET - 1)
+		BUF_SP_SIZE = 2
+		LEN_SP_OFFSET = BUF_SP_OFFSET + BUF_SP_SIZE
+		LEN_SP_SIZE = 2
+
+		; If the length is zero, quit straight away with a count of zero.
+		ldw x, (ASM_ARGS_SP_OFFSET+2, sp)
+		jreq 0004$
+
+		; Allocate count on the stack, initialised to zero.
+		clrw x
+		pushw x
+
+		; Calculate the end pointer by adding length to the buffer pointer, and
+		; store it in place of the length arg. Load the buffer pointer into the
+		; X reg.
+		ldw x, (BUF_SP_OFFSET, sp)
+		addw x, (LEN_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw x, (BUF_SP_OFFSET, sp)
+
+	0001$:
+		; Load the next byte from the buffer into the Y reg. This also
+		; initialises A, the count for this byte, to zero.
+		clrw y
+		ld a, (x)
+		exg a, yl
+
+	0002$:
+		; Shift the byte right one bit, then add carry (i.e. bit shifted off)
+		; to the byte count. Keep looping and doing this until byte is zero.
+		srlw y
+		adc a, #0
+		tnzw y
+		jrne 0002$
+
+		; Add the byte count to the total count.
+		add a, (COUNT_SP_OFFSET+1, sp)
+		ld (COUNT_SP_OFFSET+1, sp), a
+		jrnc 0003$
+		inc (COUNT_SP_OFFSET+0, sp)
+
+	0003$:
+		; Advance the buffer pointer and loop around if not yet at the end.
+		incw x
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+		; Pop the count from the stack into the X reg for return value.
+		popw x
+
+	0004$:
+		ASM_RETURN
+	__endasm;
+
+#endif
+}
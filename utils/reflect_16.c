@@ -109,3 +109,87 @@ uint16_t reflect_16(uint16_t value) __naked __stack_args {
 
 #endif
 }
+
+#if defined(__reg_args)
+
+uint16_t reflect_16_ra(uint16_t value) __naked __reg_args {
+	(void)value;
+
+#ifdef REFLECT_LUT
+
+	__asm
+		.macro reflect_16_ra_rev_swap_nibbles stk_off
+			; Load byte from given stack offset, mask upper nibble, swap it to
+			; lower position, and put into X reg.
+			ld a, (stk_off, sp)
+			and a, #0xF0
+			swap a
+			clrw x
+			ld xl, a
+
+			; Re-load byte from given stack offset, mask lower nibble, and put
+			; into Y reg.
+			ld a, (stk_off, sp)
+			and a, #0x0F
+			clrw y
+			ld yl, a
+
+			; Lookup lower nibble reflected value in table and swap it into
+			; upper nibble of result. Then do same for upper nibble and put into
+			; lower nibble of result. Copy back to given stack offset.
+			ld a, (_reflect_lut, y)
+			swap a
+			or a, (_reflect_lut, x)
+			ld (stk_off, sp), a
+		.endm
+
+		; Swap the bytes of the value arg (in X reg), then push it to the stack,
+		; because both X and Y are needed for table look-ups.
+		swapw x
+		pushw x
+
+		; Using the LUT, reverse and swap the individual nibbles of each stack
+		; byte.
+		reflect_16_ra_rev_swap_nibbles 1
+		reflect_16_ra_rev_swap_nibbles 2
+
+		; Pop resulting value from stack to X register for return value.
+		popw x
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		.macro reflect_16_ra_shift
+			srlw x
+			rlcw y
+		.endm
+
+#ifdef REFLECT_UNROLLED
+
+		.rept 16
+			reflect_16_ra_shift
+		.endm
+
+#else
+
+		ld a, #16
+
+	0001$:
+		reflect_16_ra_shift
+		dec a
+		jrne 0001$
+
+#endif
+
+		; Result was built up in Y reg, so transfer it to X reg for return
+		; value.
+		exgw x, y
+		ASM_RETURN
+	__endasm;
+
+#endif
+}
+
+#endif
@@ -92,3 +92,76 @@ uint8_t reflect_8(uint8_t value) __naked __stack_args {
 
 #endif
 }
+
+#if defined(__reg_args)
+
+uint8_t reflect_8_ra(uint8_t value) __naked __reg_args {
+	(void)value;
+
+#ifdef REFLECT_LUT
+
+	__asm
+		; Keep a copy of the value arg (in A reg) in X reg.
+		clrw x
+		ld xl, a
+
+		; Mask lower nibble of value and put into Y reg.
+		and a, #0x0F
+		clrw y
+		ld yl, a
+
+		; Take the copy of value, swap upper nibble to lower position, mask it,
+		; and put back into X reg.
+		ld a, xl
+		swap a
+		and a, #0x0F
+		ld xl, a
+
+		; Lookup lower nibble reflected value in table and swap it into upper
+		; nibble of result. Then do same for upper nibble and put into lower
+		; nibble of result.
+		ld a, (_reflect_lut, y)
+		swap a
+		or a, (_reflect_lut, x)
+
+		; Return value is already in A reg.
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		.macro reflect_8_ra_shift
+			srlw x
+			rlc a
+		.endm
+
+		; Move value arg from A reg into X reg, from where it is shifted out.
+		clrw x
+		ld xl, a
+
+#ifdef REFLECT_UNROLLED
+
+		.rept 8
+			reflect_8_ra_shift
+		.endm
+
+#else
+
+		ldw y, #8
+
+	0001$:
+		reflect_8_ra_shift
+		decw y
+		jrne 0001$
+
+#endif
+
+		; Return value is already in A reg.
+		ASM_RETURN
+	__endasm;
+
+#endif
+}
+
+#endif
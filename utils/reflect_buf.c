@@ -0,0 +1,250 @@
+/*******************************************************************************
+ *
+ * reflect_buf.c - Buffer bit-reflection implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+void reflect_buf(uint8_t *dst, const uint8_t *src, uint16_t len) __naked __stack_args {
+	(void)dst;
+	(void)src;
+	(void)len;
+
+#if defined(REFLECT_LUT_LARGE)
+
+	__asm
+		; Offsets for arguments.
+		DST_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		SRC_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+		LEN_SP_OFFSET = ASM_ARGS_SP_OFFSET + 4
+
+		; If the length is zero, quit straight away.
+		ldw x, (LEN_SP_OFFSET, sp)
+		jreq 0002$
+
+		; Calculate the end pointer by adding length to the source pointer, and
+		; store it in place of the length arg. Calculate the difference between
+		; the destination and source pointers, so that the same position in the
+		; destination can be found from the source, and store it in place of the
+		; destination pointer arg. Load the source pointer into the X reg.
+		addw x, (SRC_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw x, (DST_SP_OFFSET, sp)
+		subw x, (SRC_SP_OFFSET, sp)
+		ldw (DST_SP_OFFSET, sp), x
+		ldw x, (SRC_SP_OFFSET, sp)
+
+	0001$:
+		; Load the next byte from the source into the LSB of the Y reg (whose
+		; MSB is zeroed), and look up its reflected value from the table.
+		ld a, (x)
+		clrw y
+		ld yl, a
+		ld a, (_reflect_lut_large, y)
+
+		; Store the reflected byte to the destination, by adding the difference
+		; to the source pointer. The source byte has already been read, so this
+		; is safe even when both buffers are the same. Advance the source
+		; pointer and loop around if not yet at the end.
+		ldw y, x
+		addw y, (DST_SP_OFFSET, sp)
+		ld (y), a
+		incw x
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+	0002$:
+		ASM_RETURN
+	__endasm;
+
+#elif defined(REFLECT_LUT)
+
+	__asm
+		; Offsets for arguments.
+		DST_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		SRC_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+		LEN_SP_OFFSET = ASM_ARGS_SP_OFFSET + 4
+
+		; If the length is zero, quit straight away.
+		ldw x, (LEN_SP_OFFSET, sp)
+		jreq 0002$
+
+		; Calculate the end pointer by adding length to the source pointer, and
+		; store it in place of the length arg. Calculate the difference between
+		; the destination and source pointers, so that the same position in the
+		; destination can be found from the source, and store it in place of the
+		; destination pointer arg. Load the source pointer into the X reg.
+		addw x, (SRC_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw x, (DST_SP_OFFSET, sp)
+		subw x, (SRC_SP_OFFSET, sp)
+		ldw (DST_SP_OFFSET, sp), x
+		ldw x, (SRC_SP_OFFSET, sp)
+
+	0001$:
+		; Load the next byte from the source, mask off the high nibble, and put
+		; it in the LSB of the Y reg (whose MSB is zeroed). Look up its
+		; reflected value from the table and swap it into the high nibble of
+		; the result.
+		ld a, (x)
+		and a, #0x0F
+		clrw y
+		ld yl, a
+		ld a, (_reflect_lut, y)
+		swap a
+
+		; Temporarily exchange the result into the Y reg. Re-load the byte, but
+		; swap nibbles so we work with the high nibble, and mask it. Exchange it
+		; with the result, so it becomes the table index, then look up its
+		; reflected value and combine into the low nibble of the result.
+		exg a, yl
+		ld a, (x)
+		swap a
+		and a, #0x0F
+		exg a, yl
+		or a, (_reflect_lut, y)
+
+		; Store the reflected byte to the destination, by adding the difference
+		; to the source pointer. The source byte has already been read, so this
+		; is safe even when both buffers are the same. Advance the source
+		; pointer and loop around if not yet at the end.
+		ldw y, x
+		addw y, (DST_SP_OFFSET, sp)
+		ld (y), a
+		incw x
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+	0002$:
+		ASM_RETURN
+	__endasm;
+
+#elif defined(REFLECT_UNROLLED)
+
+	__asm
+		; Offsets for arguments.
+		DST_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		SRC_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+		LEN_SP_OFFSET = ASM_ARGS_SP_OFFSET + 4
+
+		; If the length is zero, quit straight away.
+		ldw x, (LEN_SP_OFFSET, sp)
+		jreq 0002$
+
+		; Calculate the end pointer by adding length to the source pointer, and
+		; store it in place of the length arg. Calculate the difference between
+		; the destination and source pointers, so that the same position in the
+		; destination can be found from the source, and store it in place of the
+		; destination pointer arg. Load the source pointer into the X reg.
+		addw x, (SRC_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw x, (DST_SP_OFFSET, sp)
+		subw x, (SRC_SP_OFFSET, sp)
+		ldw (DST_SP_OFFSET, sp), x
+		ldw x, (SRC_SP_OFFSET, sp)
+
+	0001$:
+		; Load the next byte from the source into the LSB of the Y reg. Shift
+		; each bit out of the Y reg and into the A reg, which reverses their
+		; order.
+		ld a, (x)
+		ld yl, a
+		.rept 8
+			srlw y
+			rlc a
+		.endm
+
+		; Store the reflected byte to the destination, by adding the difference
+		; to the source pointer. The source byte has already been read, so this
+		; is safe even when both buffers are the same. Advance the source
+		; pointer and loop around if not yet at the end.
+		ldw y, x
+		addw y, (DST_SP_OFFSET, sp)
+		ld (y), a
+		incw x
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+	0002$:
+		ASM_RETURN
+	__endasm;
+
+#else
+
+	__asm
+		; Offsets for arguments.
+		DST_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		SRC_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+		LEN_SP_OFFSET = ASM_ARGS_SP_OFFSET + 4
+
+		; If the length is zero, quit straight away.
+		ldw x, (LEN_SP_OFFSET, sp)
+		jreq 0003$
+
+		; Calculate the end pointer by adding length to the source pointer, and
+		; store it in place of the length arg. Calculate the difference between
+		; the destination and source pointers, so that the same position in the
+		; destination can be found from the source, and store it in place of the
+		; destination pointer arg. Load the source pointer into the X reg.
+		addw x, (SRC_SP_OFFSET, sp)
+		ldw (LEN_SP_OFFSET, sp), x
+		ldw x, (DST_SP_OFFSET, sp)
+		subw x, (SRC_SP_OFFSET, sp)
+		ldw (DST_SP_OFFSET, sp), x
+		ldw x, (SRC_SP_OFFSET, sp)
+
+	0001$:
+		; Load the next byte from the source into the LSB of the Y reg. Shift
+		; each bit out of the Y reg and into the A reg, which reverses their
+		; order. The A reg is initialised with a 1 in its least-significant
+		; bit, which will be shifted out into carry once all 8 bits have been
+		; shifted in, terminating the loop without the need for a counter.
+		ld a, (x)
+		ld yl, a
+		ld a, #0x01
+
+	0002$:
+		srlw y
+		rlc a
+		jrnc 0002$
+
+		; Store the reflected byte to the destination, by adding the difference
+		; to the source pointer. The source byte has already been read, so this
+		; is safe even when both buffers are the same. Advance the source
+		; pointer and loop around if not yet at the end.
+		ldw y, x
+		addw y, (DST_SP_OFFSET, sp)
+		ld (y), a
+		incw x
+		cpw x, (LEN_SP_OFFSET, sp)
+		jrne 0001$
+
+	0003$:
+		ASM_RETURN
+	__endasm;
+
+#endif
+}
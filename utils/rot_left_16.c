@@ -35,6 +35,104 @@ uint16_t rotate_left_16(uint16_t value, uint8_t count) __naked __stack_args {
 	// For return value/arg: 0xAABB
 	// x = 0xAABB (xh = 0xAA, xl = 0xBB)
 
+#if defined(ROTATE_DECOMPOSE)
+
+	// The rotation count is decomposed into a whole-byte part, done by
+	// swapping the bytes, and a residual bit part of -3 to +4 bits (i.e. rotate
+	// one byte further and then back by up to 3 bits, rather than forward by
+	// 5-7 bits). Execution time is therefore (almost) constant regardless of
+	// count, rather than linear.
+	__asm
+		; Load value arg into X register.
+		ldw x, (ASM_ARGS_SP_OFFSET+0, sp)
+
+		; Load count arg into A reg and add 3, so that bit 3 gives whether to
+		; rotate by a whole byte (rounded to nearest), and bits 0-2 give the
+		; residual number of bits plus 3. Any bits above bit 3 can be ignored,
+		; as they represent whole rotations.
+		ld a, (ASM_ARGS_SP_OFFSET+2, sp)
+		add a, #3
+
+		; If bit 3 of count is set, rotate by 8 bits by swapping the bytes.
+		bcp a, #0x08
+		jreq 0001$
+		swapw x
+
+	0001$:
+		; Mask off the residual bits count (plus 3) and subtract 3. If now zero,
+		; there is nothing left to do. If positive, rotate left by that number
+		; of bits, otherwise rotate right.
+		and a, #0x07
+		sub a, #3
+		jreq 0011$
+		jrmi 0008$
+
+		; Jump to the appropriate point in the sequence of 1-bit left rotations
+		; for the count (1-4). The A reg is loaded with a copy of the most-
+		; significant byte of the value, which is shifted left to put the
+		; current MSb into carry, from where it is shifted in to the LSb.
+		cp a, #2
+		jrult 0007$
+		jreq 0006$
+		cp a, #4
+		jrult 0005$
+		ld a, xh
+		sll a
+		rlcw x
+	0002$:
+		sll a
+		rlcw x
+	0003$:
+		sll a
+		rlcw x
+	0004$:
+		sll a
+		rlcw x
+		ASM_RETURN
+	0005$:
+		ld a, xh
+		jra 0002$
+	0006$:
+		ld a, xh
+		jra 0003$
+	0007$:
+		ld a, xh
+		jra 0004$
+
+	0008$:
+		; Negate the count to get number of bits (1-3) to rotate right by, and
+		; jump to the appropriate point in the sequence of 1-bit right
+		; rotations. The A reg is loaded with a copy of the least-significant
+		; byte of the value, which is shifted right to put the current LSb into
+		; carry, from where it is shifted in to the MSb.
+		neg a
+		cp a, #2
+		jrult 0013$
+		jreq 0012$
+		ld a, xl
+		srl a
+		rrcw x
+	0009$:
+		srl a
+		rrcw x
+	0010$:
+		srl a
+		rrcw x
+
+	0011$:
+		; The X reg now contains rotated value, so leave it there as function
+		; return value.
+		ASM_RETURN
+	0012$:
+		ld a, xl
+		jra 0009$
+	0013$:
+		ld a, xl
+		jra 0010$
+	__endasm;
+
+#else
+
 	__asm
 		; Load value arg into X register.
 		ldw x, (ASM_ARGS_SP_OFFSET+0, sp)
@@ -65,4 +163,141 @@ uint16_t rotate_left_16(uint16_t value, uint8_t count) __naked __stack_args {
 		; return value.
 		ASM_RETURN
 	__endasm;
+
+#endif
+}
+
+#if defined(__reg_args)
+
+uint16_t rotate_left_16_ra(uint16_t value, uint8_t count) __naked __reg_args {
+	(void)value;
+	(void)count;
+
+	// For return value/arg: 0xAABB
+	// x = 0xAABB (xh = 0xAA, xl = 0xBB)
+
+#if defined(ROTATE_DECOMPOSE)
+
+	// The rotation count is decomposed into a whole-byte part, done by
+	// swapping the bytes, and a residual bit part of -3 to +4 bits (i.e. rotate
+	// one byte further and then back by up to 3 bits, rather than forward by
+	// 5-7 bits). Execution time is therefore (almost) constant regardless of
+	// count, rather than linear.
+	__asm
+		; Value arg is already in X reg and count arg in A reg. Add 3 to count,
+		; so that bit 3 gives whether to rotate by a whole byte (rounded to
+		; nearest), and bits 0-2 give the residual number of bits plus 3. Any
+		; bits above bit 3 can be ignored, as they represent whole rotations.
+		add a, #3
+
+		; If bit 3 of count is set, rotate by 8 bits by swapping the bytes.
+		bcp a, #0x08
+		jreq 0001$
+		swapw x
+
+	0001$:
+		; Mask off the residual bits count (plus 3) and subtract 3. If now zero,
+		; there is nothing left to do. If positive, rotate left by that number
+		; of bits, otherwise rotate right.
+		and a, #0x07
+		sub a, #3
+		jreq 0011$
+		jrmi 0008$
+
+		; Jump to the appropriate point in the sequence of 1-bit left rotations
+		; for the count (1-4). The A reg is loaded with a copy of the most-
+		; significant byte of the value, which is shifted left to put the
+		; current MSb into carry, from where it is shifted in to the LSb.
+		cp a, #2
+		jrult 0007$
+		jreq 0006$
+		cp a, #4
+		jrult 0005$
+		ld a, xh
+		sll a
+		rlcw x
+	0002$:
+		sll a
+		rlcw x
+	0003$:
+		sll a
+		rlcw x
+	0004$:
+		sll a
+		rlcw x
+		ASM_RETURN
+	0005$:
+		ld a, xh
+		jra 0002$
+	0006$:
+		ld a, xh
+		jra 0003$
+	0007$:
+		ld a, xh
+		jra 0004$
+
+	0008$:
+		; Negate the count to get number of bits (1-3) to rotate right by, and
+		; jump to the appropriate point in the sequence of 1-bit right
+		; rotations. The A reg is loaded with a copy of the least-significant
+		; byte of the value, which is shifted right to put the current LSb into
+		; carry, from where it is shifted in to the MSb.
+		neg a
+		cp a, #2
+		jrult 0013$
+		jreq 0012$
+		ld a, xl
+		srl a
+		rrcw x
+	0009$:
+		srl a
+		rrcw x
+	0010$:
+		srl a
+		rrcw x
+
+	0011$:
+		; The X reg now contains rotated value, so leave it there as function
+		; return value.
+		ASM_RETURN
+	0012$:
+		ld a, xl
+		jra 0009$
+	0013$:
+		ld a, xl
+		jra 0010$
+	__endasm;
+
+#else
+
+	__asm
+		; Value arg is already in X reg and count arg in A reg. Mask count to
+		; ensure it wraps round if >= 16. If then count is zero, quit straight
+		; away.
+		and a, #0x0F
+		jreq 0003$
+
+	0001$:
+		; Shift all bits left one place.
+		sllw x
+
+		; Set least-significant bit of X if bit previously shifted off was 1
+		; (i.e. carry flag was set).
+		jrnc 0002$
+		incw x
+
+	0002$:
+		; Decrement count and loop around if it is not zero.
+		dec a
+		jrne 0001$
+
+	0003$:
+		; The X reg now contains rotated value, so leave it there as function
+		; return value.
+		ASM_RETURN
+	__endasm;
+
+#endif
 }
+
+#endif
@@ -35,6 +35,66 @@ uint8_t rotate_left_8(uint8_t value, uint8_t count) __naked __stack_args {
 	// For return value/arg: 0xAA
 	// a = 0xAA
 
+#if defined(ROTATE_DECOMPOSE)
+
+	// The rotation count is decomposed into a whole-nibble part, done by
+	// swapping the nibbles, and a residual bit part of -1 to +2 bits (i.e.
+	// rotate one nibble further and then back by 1 bit, rather than forward by
+	// 3 bits). Execution time is therefore (almost) constant regardless of
+	// count, rather than linear.
+	__asm
+		; Load count arg into low byte of X reg and add 1, so that bit 2 gives
+		; whether to rotate by a whole nibble (rounded to nearest), and bits 0-1
+		; give the residual number of bits plus 1. Any bits above bit 2 can be
+		; ignored, as they represent whole rotations. Each of the bits is then
+		; tested in turn by shifting it out of X into carry.
+		ld a, (ASM_ARGS_SP_OFFSET+1, sp)
+		inc a
+		ld xl, a
+
+		; Load value arg into A register.
+		ld a, (ASM_ARGS_SP_OFFSET+0, sp)
+
+		; Residual bits (plus 1) of 0 means rotate right by 1, 1 means nothing
+		; to do, 2 means rotate left by 1, and 3 means rotate left by 2.
+		srlw x
+		jrc 0001$
+		srlw x
+		jrc 0002$
+
+		; Rotate right by 1 bit. Set most-significant bit of A if bit shifted
+		; off was 1 (i.e. carry flag was set).
+		srl a
+		jrnc 0003$
+		add a, #0x80
+		jra 0003$
+
+	0001$:
+		srlw x
+		jrnc 0003$
+
+		; Rotate left by 1 or 2 bits. Add the bit shifted off (i.e. carry flag)
+		; back in to the least-significant bit of A.
+		sll a
+		adc a, #0x00
+	0002$:
+		sll a
+		adc a, #0x00
+
+	0003$:
+		; If bit 2 of count is set, rotate by 4 bits by swapping the nibbles.
+		srlw x
+		jrnc 0004$
+		swap a
+
+	0004$:
+		; The A reg now contains rotated value, so leave it there as function
+		; return value.
+		ASM_RETURN
+	__endasm;
+
+#else
+
 	__asm
 		; First mask count arg to ensure it wraps round if >= 8.
 		ld a, (ASM_ARGS_SP_OFFSET+1, sp)
@@ -69,4 +129,6 @@ uint8_t rotate_left_8(uint8_t value, uint8_t count) __naked __stack_args {
 		; return value.
 		ASM_RETURN
 	__endasm;
+
+#endif
 }
@@ -36,6 +36,124 @@ uint32_t rotate_right_32(uint32_t value, uint8_t count) __naked __stack_args {
 	// y = 0xAABB (yh = 0xAA, yl = 0xBB)
 	// x = 0xCCDD (xh = 0xCC, xl = 0xDD)
 
+#if defined(ROTATE_DECOMPOSE)
+
+	// The rotation count is decomposed into a whole-byte part, done by
+	// exchanging/rotating bytes between registers, and a residual bit part of
+	// -3 to +4 bits (i.e. rotate one byte further and then back by up to 3
+	// bits, rather than forward by 5-7 bits). Execution time is therefore
+	// (almost) constant regardless of count, rather than linear.
+	__asm
+		; Load value arg into X & Y registers.
+		ldw y, (ASM_ARGS_SP_OFFSET+0, sp)
+		ldw x, (ASM_ARGS_SP_OFFSET+2, sp)
+
+		; Load count arg into A reg and add 3, so that bits 3-4 give the number
+		; of bytes to rotate by (rounded to nearest), and bits 0-2 give the
+		; residual number of bits plus 3. Any bits above bit 4 can be ignored,
+		; as they represent whole rotations.
+		ld a, (ASM_ARGS_SP_OFFSET+4, sp)
+		add a, #3
+
+		; If bit 4 of count is set, rotate by 16 bits by exchanging the words.
+		bcp a, #0x10
+		jreq 0001$
+		exgw x, y
+
+	0001$:
+		; If bit 3 of count is set, rotate right by 8 bits. Shifts the bytes one
+		; place right through the A reg (whose original value is saved on the
+		; stack), with LSB of X ending up as MSB of Y.
+		bcp a, #0x08
+		jreq 0002$
+		push a
+		ld a, xl
+		rrwa y
+		rrwa x
+		pop a
+
+	0002$:
+		; Mask off the residual bits count (plus 3) and subtract 3. If now zero,
+		; there is nothing left to do. If positive, rotate right by that number
+		; of bits, otherwise rotate left.
+		and a, #0x07
+		sub a, #3
+		jreq 0012$
+		jrmi 0009$
+
+		; Jump to the appropriate point in the sequence of 1-bit right
+		; rotations for the count (1-4). The A reg is loaded with a copy of the
+		; least-significant byte of the value, which is shifted right to put the
+		; current LSb into carry, from where it is shifted in to the MSb.
+		cp a, #2
+		jrult 0008$
+		jreq 0007$
+		cp a, #4
+		jrult 0006$
+		ld a, xl
+		srl a
+		rrcw y
+		rrcw x
+	0003$:
+		srl a
+		rrcw y
+		rrcw x
+	0004$:
+		srl a
+		rrcw y
+		rrcw x
+	0005$:
+		srl a
+		rrcw y
+		rrcw x
+		ASM_RETURN
+	0006$:
+		ld a, xl
+		jra 0003$
+	0007$:
+		ld a, xl
+		jra 0004$
+	0008$:
+		ld a, xl
+		jra 0005$
+
+	0009$:
+		; Negate the count to get number of bits (1-3) to rotate left by, and
+		; jump to the appropriate point in the sequence of 1-bit left rotations.
+		; The A reg is loaded with a copy of the most-significant byte of the
+		; value, which is shifted left to put the current MSb into carry, from
+		; where it is shifted in to the LSb.
+		neg a
+		cp a, #2
+		jrult 0014$
+		jreq 0013$
+		ld a, yh
+		sll a
+		rlcw x
+		rlcw y
+	0010$:
+		sll a
+		rlcw x
+		rlcw y
+	0011$:
+		sll a
+		rlcw x
+		rlcw y
+
+	0012$:
+		; The X and Y registers now contain rotated value, so leave them there
+		; as function return value.
+		ASM_RETURN
+	0013$:
+		ld a, yh
+		jra 0010$
+	0014$:
+		ld a, yh
+		jra 0011$
+	__endasm;
+
+#else
+
 	__asm
 		; Load value arg into X & Y registers.
 		ldw y, (ASM_ARGS_SP_OFFSET+0, sp)
@@ -67,4 +185,6 @@ uint32_t rotate_right_32(uint32_t value, uint8_t count) __naked __stack_args {
 		; as function return value.
 		ASM_RETURN
 	__endasm;
+
+#endif
 }
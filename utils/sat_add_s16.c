@@ -0,0 +1,55 @@
+/*******************************************************************************
+ *
+ * sat_add_s16.c - Saturating signed 16-bit addition implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+int16_t sat_add_s16(int16_t a, int16_t b) __naked __stack_args {
+	(void)a;
+	(void)b;
+
+	__asm
+		; Add the b arg to the a arg. If there is no overflow (i.e. the sum
+		; is within the signed 16-bit range), the result is returned as is.
+		ldw x, (ASM_ARGS_SP_OFFSET+0, sp)
+		addw x, (ASM_ARGS_SP_OFFSET+2, sp)
+		jrnv 0001$
+
+		; On overflow, the sign of the result is the opposite of the true
+		; sign. Shift the (wrong) sign bit into carry, then load the maximum
+		; value, incrementing it to the minimum if the true result is
+		; negative.
+		sllw x
+		ldw x, #0x7FFF
+		jrc 0001$
+		incw x
+
+	0001$:
+		; Return with the result in the X reg.
+		ASM_RETURN
+	__endasm;
+}
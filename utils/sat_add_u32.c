@@ -0,0 +1,66 @@
+/*******************************************************************************
+ *
+ * sat_add_u32.c - Saturating unsigned 32-bit addition implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+uint32_t sat_add_u32(uint32_t a, uint32_t b) __naked __stack_args {
+	(void)a;
+	(void)b;
+
+	// For return value: 0xAABBCCDD
+	// y = 0xAABB (yh = 0xAA, yl = 0xBB)
+	// x = 0xCCDD (xh = 0xCC, xl = 0xDD)
+
+	__asm
+		; Offsets for arguments.
+		A_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		B_SP_OFFSET = ASM_ARGS_SP_OFFSET + 4
+
+		; Add the lower halves of the args with a 16-bit op, then the upper
+		; halves a byte at a time, so that the carry propagates through and
+		; the final flags reflect the whole 32-bit result.
+		ldw x, (A_SP_OFFSET+2, sp)
+		addw x, (B_SP_OFFSET+2, sp)
+		ld a, (A_SP_OFFSET+1, sp)
+		adc a, (B_SP_OFFSET+1, sp)
+		ld yl, a
+		ld a, (A_SP_OFFSET+0, sp)
+		adc a, (B_SP_OFFSET+0, sp)
+		ld yh, a
+
+		; If there is a carry (i.e. the sum is outside the unsigned 32-bit
+		; range), saturate the result to the maximum value.
+		jrnc 0001$
+		ldw x, #0xFFFF
+		ldw y, x
+
+	0001$:
+		; Return with the result in the X and Y regs.
+		ASM_RETURN
+	__endasm;
+}
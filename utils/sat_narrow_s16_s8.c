@@ -0,0 +1,56 @@
+/*******************************************************************************
+ *
+ * sat_narrow_s16_s8.c - Saturating 16- to 8-bit narrowing implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+int8_t sat_narrow_s16_s8(int16_t value) __naked __stack_args {
+	(void)value;
+
+	__asm
+		; Load the value arg into the X reg. If it is greater than the maximum
+		; or less than the minimum signed 8-bit value, saturate the result to
+		; that limit.
+		ldw x, (ASM_ARGS_SP_OFFSET+0, sp)
+		cpw x, #0x007F
+		jrsgt 0001$
+		cpw x, #0xFF80
+		jrslt 0002$
+
+		; Otherwise, the value is in range, so its lower byte is the result.
+		ld a, xl
+		ASM_RETURN
+
+	0001$:
+		ld a, #0x7F
+		ASM_RETURN
+
+	0002$:
+		ld a, #0x80
+		ASM_RETURN
+	__endasm;
+}
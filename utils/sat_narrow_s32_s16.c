@@ -0,0 +1,73 @@
+/*******************************************************************************
+ *
+ * sat_narrow_s32_s16.c - Saturating 32- to 16-bit narrowing implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+int16_t sat_narrow_s32_s16(int32_t value) __naked __stack_args {
+	(void)value;
+
+	// For arg: 0xAABBCCDD
+	// y = 0xAABB (yh = 0xAA, yl = 0xBB)
+	// x = 0xCCDD (xh = 0xCC, xl = 0xDD)
+
+	__asm
+		; Load the value arg into the X and Y regs. The value is within the
+		; signed 16-bit range only if the upper half is the sign-extension of
+		; the lower half (i.e. all zero or all one bits, matching the lower
+		; half's sign bit).
+		ldw x, (ASM_ARGS_SP_OFFSET+2, sp)
+		ldw y, (ASM_ARGS_SP_OFFSET+0, sp)
+		jrmi 0002$
+
+		; The value is positive. If the upper half is non-zero, or the lower
+		; half's sign bit is set, the value is too large, so saturate the
+		; result to the maximum.
+		jrne 0001$
+		tnzw x
+		jrpl 0004$
+	0001$:
+		ldw x, #0x7FFF
+		ASM_RETURN
+
+	0002$:
+		; The value is negative. If the upper half is not all ones (so does
+		; not become zero when incremented), or the lower half's sign bit is
+		; clear, the value is too small, so saturate the result to the
+		; minimum.
+		incw y
+		jrne 0003$
+		tnzw x
+		jrmi 0004$
+	0003$:
+		ldw x, #0x8000
+
+	0004$:
+		; Return with the result in the X reg.
+		ASM_RETURN
+	__endasm;
+}
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ *
+ * sat_sub_s32.c - Saturating signed 32-bit subtraction implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+int32_t sat_sub_s32(int32_t a, int32_t b) __naked __stack_args {
+	(void)a;
+	(void)b;
+
+	// For return value: 0xAABBCCDD
+	// y = 0xAABB (yh = 0xAA, yl = 0xBB)
+	// x = 0xCCDD (xh = 0xCC, xl = 0xDD)
+
+	__asm
+		; Offsets for arguments.
+		A_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		B_SP_OFFSET = ASM_ARGS_SP_OFFSET + 4
+
+		; Subtract the lower halves of the args with a 16-bit op, then the upper
+		; halves a byte at a time, so that the carry propagates through and the
+		; final flags reflect the whole 32-bit result.
+		ldw x, (A_SP_OFFSET+2, sp)
+		subw x, (B_SP_OFFSET+2, sp)
+		ld a, (A_SP_OFFSET+1, sp)
+		sbc a, (B_SP_OFFSET+1, sp)
+		ld yl, a
+		ld a, (A_SP_OFFSET+0, sp)
+		sbc a, (B_SP_OFFSET+0, sp)
+		ld yh, a
+
+		; If there is no overflow (i.e. the difference is within the signed
+		; 32-bit range), the result is returned as is.
+		jrnv 0001$
+
+		; On overflow, the sign of the result is the opposite of the true sign.
+		; Shift the (wrong) sign bit into carry, then load the maximum value,
+		; incrementing it to the minimum if the true result is negative.
+		sll a
+		ldw x, #0xFFFF
+		ldw y, #0x7FFF
+		jrc 0001$
+		incw x
+		incw y
+
+	0001$:
+		; Return with the result in the X and Y regs.
+		ASM_RETURN
+	__endasm;
+}
@@ -0,0 +1,55 @@
+/*******************************************************************************
+ *
+ * sat_sub_s8.c - Saturating signed 8-bit subtraction implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+int8_t sat_sub_s8(int8_t a, int8_t b) __naked __stack_args {
+	(void)a;
+	(void)b;
+
+	__asm
+		; Subtract the b arg from the a arg. If there is no overflow (i.e. the
+		; difference is within the signed 8-bit range), the result is returned
+		; as is.
+		ld a, (ASM_ARGS_SP_OFFSET+0, sp)
+		sub a, (ASM_ARGS_SP_OFFSET+1, sp)
+		jrnv 0001$
+
+		; On overflow, the sign of the result is the opposite of the true sign.
+		; Shift the (wrong) sign bit into carry and subtract it from 0x80,
+		; giving 0x7F (the maximum) when the true result is positive, or 0x80
+		; (the minimum) when negative.
+		sll a
+		ld a, #0x80
+		sbc a, #0
+
+	0001$:
+		; Return with the result in the A reg.
+		ASM_RETURN
+	__endasm;
+}
@@ -0,0 +1,48 @@
+/*******************************************************************************
+ *
+ * sat_sub_u16.c - Saturating unsigned 16-bit subtraction implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+uint16_t sat_sub_u16(uint16_t a, uint16_t b) __naked __stack_args {
+	(void)a;
+	(void)b;
+
+	__asm
+		; Subtract the b arg from the a arg. If there is a carry (i.e. the
+		; difference is outside the unsigned 16-bit range), saturate the result
+		; to zero.
+		ldw x, (ASM_ARGS_SP_OFFSET+0, sp)
+		subw x, (ASM_ARGS_SP_OFFSET+2, sp)
+		jrnc 0001$
+		clrw x
+
+	0001$:
+		; Return with the result in the X reg.
+		ASM_RETURN
+	__endasm;
+}
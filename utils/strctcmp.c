@@ -41,50 +41,67 @@ int strctcmp(const char *s1, const char *s2) __naked __stack_args {
 		; Load argument pointers to X & Y registers. Will return non-zero if
 		; either is null.
 		ldw x, (ASM_ARGS_SP_OFFSET+0+1, sp)
-		jreq 0004$
+		jreq 0005$
 		ldw y, (ASM_ARGS_SP_OFFSET+2+1, sp)
-		jreq 0004$
+		jreq 0005$
 
 		; Reset comparison result to zero.
 		clr (1, sp)
 
+		; The loop is unrolled to handle two characters per iteration. Each
+		; character takes the same number of cycles regardless of the content
+		; of either string, so execution time depends only on the length of
+		; the first string.
+
 	0001$:
-		; Compare the current characters from each string pointer by XOR-ing
-		; them together. When same, resulting value will be zero, otherwise non-
-		; zero. Then OR that with the comparison result - as soon as there is a
-		; mismatch, it will become non-zero and stay like that as we continue
-		; through the entire string.
+		; Load the current character from the first string. If it is the null
+		; terminating byte, exit the loop to do the final comparison.
+		; Otherwise, compare it with the current character from the second
+		; string by XOR-ing them together. When same, resulting value will be
+		; zero, otherwise non-zero. Then OR that with the comparison result -
+		; as soon as there is a mismatch, it will become non-zero and stay like
+		; that as we continue through the entire string. Increment the first
+		; string pointer.
 		ld a, (x)
+		jreq 0004$
 		xor a, (y)
 		or a, (1, sp)
 		ld (1, sp), a
-
-		; If we reached null terminating byte in first string, exit loop.
-		; Otherwise, increment its pointer.
-		tnz (x)
-		jreq 0004$
 		incw x
 
-		; Test if reached null terminating byte of second string or not. When
-		; non-null, execute an extra no-op to balance the non-taken jump. That
-		; is, 2 cycles are always consumed regardless of test outcome (when
-		; null, JREQ (2) = 2; when non-null, JREQ (1) + NOP (1) = 2).
+		; If not at the null terminating byte of the second string, increment
+		; its pointer. Either way, 2 cycles are always consumed, so no balancing
+		; no-ops are needed (when null, JREQ (2) = 2; when non-null, JREQ (1) +
+		; INCW (1) = 2).
 		tnz (y)
-		jreq 0003$
-		nop
+		jreq 0002$
+		incw y
 
 	0002$:
-		; If not at end of second string, increment its pointer and loop.
+		; Do the same again for the next character.
+		ld a, (x)
+		jreq 0004$
+		xor a, (y)
+		or a, (1, sp)
+		ld (1, sp), a
+		incw x
+		tnz (y)
+		jreq 0003$
 		incw y
-		jra 0001$
 
 	0003$:
-		; If we are at end of second string, in order to balance operations, do
-		; a no-op instead to equal the above incrementation in terms of cycles.
-		nop
 		jra 0001$
 
 	0004$:
+		; At the end of the first string, compare its null terminating byte
+		; with the current character of the second string. As the first is
+		; zero, this is simply OR-ing the second string character into the
+		; comparison result.
+		ld a, (y)
+		or a, (1, sp)
+		ld (1, sp), a
+
+	0005$:
 		; Return comparison result in X register.
 		clrw x
 		pop a
@@ -0,0 +1,111 @@
+/*******************************************************************************
+ *
+ * strtou16.c - Decimal string to unsigned 16-bit integer implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+uint8_t strtou16(const char *str, uint16_t *value) __naked __stack_args {
+	(void)str;
+	(void)value;
+
+	__asm
+		; Offsets for arguments.
+		STR_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		VALUE_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+
+		; Load the string pointer into the Y reg, and initialise the
+		; accumulated value in the X reg to zero.
+		ldw y, (STR_SP_OFFSET, sp)
+		clrw x
+
+	0001$:
+		; Convert the next character from ASCII to a digit value. Subtracting
+		; '0' means any character below it wraps around to a large value, so
+		; a single unsigned comparison detects any non-digit character, which
+		; ends the number.
+		ld a, (y)
+		sub a, #0x30
+		cp a, #10
+		jruge 0003$
+
+		; Multiply the accumulated value by 10 with shifts and an addition, as
+		; ((x << 2) + x) << 1. The original value is pushed on to the stack so
+		; it can be added. Each step carrying out of the 16-bit value means
+		; the result has overflowed.
+		pushw x
+		sllw x
+		jrc 0002$
+		sllw x
+		jrc 0002$
+		addw x, (1, sp)
+		jrc 0002$
+		sllw x
+		jrc 0002$
+
+		; Add the digit to the accumulated value, zero-extending it to 16 bits
+		; by re-using the stack space of the original value, which is no longer
+		; needed. Again, a carry means overflow.
+		clr (1, sp)
+		ld (2, sp), a
+		addw x, (1, sp)
+		jrc 0002$
+		addw sp, #2
+
+		; Advance the pointer and loop around for the next character.
+		incw y
+		jra 0001$
+
+	0002$:
+		; The value has overflowed, so discard the stack space used during
+		; the multiplication and return zero.
+		addw sp, #2
+		jra 0004$
+
+	0003$:
+		; Determine the number of characters consumed from the difference
+		; between the pointer and the start of the string. If there were none,
+		; or too many to be represented by the 8-bit return value, return zero.
+		subw y, (STR_SP_OFFSET, sp)
+		cpw y, #0x0100
+		jruge 0004$
+		ld a, yl
+		tnz a
+		jreq 0005$
+
+		; Store the value at the destination pointer, and return the number
+		; of characters consumed (still in the A reg).
+		ldw y, (VALUE_SP_OFFSET, sp)
+		ldw (y), x
+		ASM_RETURN
+
+	0004$:
+		clr a
+
+	0005$:
+		ASM_RETURN
+	__endasm;
+}
@@ -0,0 +1,147 @@
+/*******************************************************************************
+ *
+ * strtou32.c - Decimal string to unsigned 32-bit integer implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+uint8_t strtou32(const char *str, uint32_t *value) __naked __stack_args {
+	(void)str;
+	(void)value;
+
+	// For accumulated value: 0xAABBCCDD
+	// y = 0xAABB (yh = 0xAA, yl = 0xBB)
+	// x = 0xCCDD (xh = 0xCC, xl = 0xDD)
+
+	__asm
+		; Offsets for arguments, once the string pointer has been pushed on to
+		; the stack.
+		STR_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2 + 0
+		VALUE_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2 + 2
+
+		; The accumulated value needs both the X and Y regs, so keep a copy of
+		; the string pointer on the stack. Initialise the value to zero.
+		ldw x, (ASM_ARGS_SP_OFFSET, sp)
+		pushw x
+		clrw x
+		clrw y
+
+	0001$:
+		; Load the next character via the pointer on the stack (temporarily
+		; saving the lower half of the value), and advance the pointer. Convert
+		; the character from ASCII to a digit value; subtracting '0' means any
+		; character below it wraps around to a large value, so a single
+		; unsigned comparison detects any non-digit character, which ends the
+		; number.
+		pushw x
+		ldw x, (3, sp)
+		ld a, (x)
+		incw x
+		ldw (3, sp), x
+		popw x
+		sub a, #0x30
+		cp a, #10
+		jruge 0005$
+
+		; Multiply the accumulated value by 10 with shifts and an addition, as
+		; ((v << 2) + v) << 1. The original value is pushed on to the stack so
+		; it can be added. Each step carrying out of the 32-bit value means
+		; the result has overflowed. When adding the lower half, the carry is
+		; propagated by incrementing the upper half, which has overflowed if
+		; it wraps around to zero.
+		pushw x
+		pushw y
+		sllw x
+		rlcw y
+		jrc 0004$
+		sllw x
+		rlcw y
+		jrc 0004$
+		addw x, (3, sp)
+		jrnc 0002$
+		incw y
+		jreq 0004$
+	0002$:
+		addw y, (1, sp)
+		jrc 0004$
+		sllw x
+		rlcw y
+		jrc 0004$
+
+		; Add the digit to the accumulated value, zero-extending it to 16 bits
+		; by re-using the stack space of the original value, which is no longer
+		; needed. Again, propagate any carry and check for overflow.
+		clr (3, sp)
+		ld (4, sp), a
+		addw x, (3, sp)
+		jrnc 0003$
+		incw y
+		jreq 0004$
+	0003$:
+		addw sp, #4
+		jra 0001$
+
+	0004$:
+		; The value has overflowed, so discard the stack space used during
+		; the multiplication and for the pointer, and return zero.
+		addw sp, #6
+		clr a
+		ASM_RETURN
+
+	0005$:
+		; Save the value on the stack, then determine the number of characters
+		; consumed from the difference between the pointer (less one, as it
+		; has already been advanced past the terminating character) and the
+		; start of the string. If there were none, or too many to be
+		; represented by the 8-bit return value, return zero.
+		pushw y
+		pushw x
+		ldw x, (5, sp)
+		decw x
+		subw x, (STR_SP_OFFSET+4, sp)
+		cpw x, #0x0100
+		jruge 0006$
+		ld a, xl
+		tnz a
+		jreq 0006$
+
+		; Store the value at the destination pointer, popping it off the
+		; stack, and return the number of characters consumed (still in the A
+		; reg).
+		ldw x, (VALUE_SP_OFFSET+4, sp)
+		popw y
+		ldw (2, x), y
+		popw y
+		ldw (x), y
+		popw x
+		ASM_RETURN
+
+	0006$:
+		addw sp, #6
+		clr a
+		ASM_RETURN
+	__endasm;
+}
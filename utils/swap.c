@@ -37,3 +37,17 @@ uint8_t swap(const uint8_t value) __naked __stack_args {
 		ASM_RETURN
 	__endasm;
 }
+
+#if defined(__reg_args)
+
+uint8_t swap_ra(const uint8_t value) __naked __reg_args {
+	(void)value;
+
+	__asm
+		; Value arg is already in A reg.
+		swap a
+		ASM_RETURN
+	__endasm;
+}
+
+#endif
@@ -0,0 +1,79 @@
+/*******************************************************************************
+ *
+ * utoa_16.c - Unsigned 16-bit integer to decimal string implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+uint8_t utoa_16(uint16_t value, char *buf) __naked __stack_args {
+	(void)value;
+	(void)buf;
+
+	__asm
+		; Offsets for arguments.
+		VALUE_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		BUF_SP_OFFSET = ASM_ARGS_SP_OFFSET + 2
+
+		; Load the value arg into the X reg and the buffer pointer into the Y
+		; reg.
+		ldw x, (VALUE_SP_OFFSET, sp)
+		ldw y, (BUF_SP_OFFSET, sp)
+
+		; Digits are produced least-significant first, so they are pushed on
+		; to the stack, to be popped off in the correct order afterwards. First
+		; push a null terminator, which marks the end of the digits.
+		push #0
+
+	0001$:
+		; Divide the value by 10. The remainder is the next digit, which is
+		; converted to an ASCII character and pushed on to the stack. Loop
+		; around while the quotient is non-zero (so a value of zero still
+		; gives a single digit).
+		ld a, #10
+		div x, a
+		add a, #0x30
+		push a
+		tnzw x
+		jrne 0001$
+
+	0002$:
+		; Pop each character off the stack and store it in the buffer, until
+		; the null terminator has been stored.
+		pop a
+		ld (y), a
+		jreq 0003$
+		incw y
+		jra 0002$
+
+	0003$:
+		; Return the length of the string (i.e. excluding the terminator),
+		; which is the difference between the pointer to the terminator and
+		; the start of the buffer.
+		ld a, yl
+		sub a, (BUF_SP_OFFSET+1, sp)
+		ASM_RETURN
+	__endasm;
+}
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ *
+ * utoa_32.c - Unsigned 32-bit integer to decimal string implementation
+ *
+ * Copyright (c) 2023 Basil Hussain
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "common.h"
+#include "../utils.h"
+
+uint8_t utoa_32(uint32_t value, char *buf) __naked __stack_args {
+	(void)value;
+	(void)buf;
+
+	__asm
+		.macro utoa_32_div_byte offset
+			; Move the remainder so far from the LSB to the MSB of the X reg,
+			; load the next byte of the value into the LSB, and divide by 100.
+			; The quotient (which fits in a byte, because the remainder is
+			; less than 100) replaces the value byte, and the new remainder is
+			; left in the LSB of the X reg.
+			ld a, xl
+			ld xh, a
+			ld a, (VALUE_SP_OFFSET+offset, y)
+			ld xl, a
+			ld a, #100
+			div x, a
+			exg a, xl
+			ld (VALUE_SP_OFFSET+offset, y), a
+		.endm
+
+		; Offsets for arguments. These are accessed relative to the Y reg,
+		; which holds a copy of the stack pointer as it is on entry, because
+		; the stack pointer itself moves as digits are pushed.
+		VALUE_SP_OFFSET = ASM_ARGS_SP_OFFSET + 0
+		BUF_SP_OFFSET = ASM_ARGS_SP_OFFSET + 4
+
+		ldw y, sp
+
+		; Digits are produced least-significant first, so they are pushed on
+		; to the stack, to be popped off in the correct order afterwards. First
+		; push a null terminator, which marks the end of the digits.
+		push #0
+
+	0001$:
+		; Divide the value (held in place of its arg) by 100, one byte at a
+		; time from the MSB. This gives two digits per iteration.
+		clrw x
+		utoa_32_div_byte 0
+		utoa_32_div_byte 1
+		utoa_32_div_byte 2
+		utoa_32_div_byte 3
+
+		; Divide the remainder by 10 to split it into the two digits. Convert
+		; the least-significant digit to an ASCII character and push it on to
+		; the stack. Also convert the other digit, but keep it in the A reg.
+		ld a, #10
+		div x, a
+		add a, #0x30
+		push a
+		ld a, xl
+		add a, #0x30
+
+		; If the quotient is non-zero, push the other digit and loop around.
+		; The quotient can only be loaded relative to the X reg itself, so
+		; copy the base pointer into it first.
+		ldw x, y
+		ldw x, (VALUE_SP_OFFSET+0, x)
+		jrne 0002$
+		ldw x, y
+		ldw x, (VALUE_SP_OFFSET+2, x)
+		jrne 0002$
+
+		; Otherwise, this is the most-significant digit, so only push it if it
+		; is not a leading zero.
+		cp a, #0x30
+		jreq 0003$
+		push a
+		jra 0003$
+
+	0002$:
+		push a
+		jra 0001$
+
+	0003$:
+		; Load the buffer pointer into the Y reg.
+		ldw y, (BUF_SP_OFFSET, y)
+
+	0004$:
+		; Pop each character off the stack and store it in the buffer, until
+		; the null terminator has been stored.
+		pop a
+		ld (y), a
+		jreq 0005$
+		incw y
+		jra 0004$
+
+	0005$:
+		; Return the length of the string (i.e. excluding the terminator),
+		; which is the difference between the pointer to the terminator and
+		; the start of the buffer.
+		ld a, yl
+		sub a, (BUF_SP_OFFSET+1, sp)
+		ASM_RETURN
+	__endasm;
+}